@@ -14,7 +14,9 @@
 #include "../src/address/mac_address.hpp"
 #include "../src/chip/wiznet_w5500.hpp"
 #include "../src/socket/abstract_socket.hpp"
+#include "../src/socket/socket_task.hpp"
 #include "../src/socket/tcp_socket.hpp"
 #include "../src/socket/udp_socket.hpp"
+#include "../src/trace/trace.hpp"
 
 #endif //__W5500_HP__
\ No newline at end of file
@@ -3,22 +3,54 @@
  *  \brief  This is an example file for an basic host send operation.
  *  
  *  The W5500 listens on PORT 1000. After a new connection is established,
- *  the chip sends a message to the client.
+ *  the chip sends a message to the client. INTn is wired to INT0, whose ISR
+ *  only records the event, so the main loop doesn't touch the SPI bus and
+ *  stays free for other work while waiting.
  */
 
 #include "w5500.hpp"
 
+#include <avr/interrupt.h>
+#include <avr/io.h>
+
+namespace
+{
+W5500* interruptChip = nullptr;
+} // namespace
+
+ISR(INT0_vect)
+{
+    interruptChip->notifyInterrupt();
+}
+
+void onStateChanged(TcpSocket& socket, const TcpState& state)
+{
+    if (TcpState::Established == state)
+    {
+        socket.send("Successfully connected to 192.168.178.101.");
+    }
+}
+
 int main(void)
 {
     W5500 chip = W5500("00-08-dc-ff-ff-ff", "192.168.178.1", "255.255.255.0", "192.168.178.101");
+    interruptChip = &chip;
 
     TcpSocket socket;
     socket.bind(&chip, 1000);
+    socket.addStateCallbackFunction(onStateChanged);
     socket.open();
     socket.listen();
 
-    socket.waitForConnected();
-    socket.send("Successfully connected to 192.168.178.101.");
+    /* INTn is active low, so INT0 triggers on the falling edge. */
+    EICRA |= (1 << ISC01);
+    EIMSK |= (1 << INT0);
+    sei();
+
+    while (true)
+    {
+        chip.poll();
+    }
 
     return 0;
 }
@@ -0,0 +1,71 @@
+/**
+ *  \file   host_benchmark.cpp
+ *  \brief  This is an example file for running the driver against the simulated W5500.
+ *
+ *  Build the library with W5500_AVR_HOST_SIMULATION enabled and link this
+ *  file on the host. The simulated peer connects to the listening socket,
+ *  the driver sends a payload and the SPI traffic needed per payload byte is
+ *  printed. The traffic includes the register reads polling for SEND_OK and
+ *  free TX buffer space.
+ */
+
+#include "w5500.hpp"
+
+#include <avr/interrupt.h>
+#include <stdio.h>
+#include <w5500_simulator.hpp>
+
+/* Drives sendAsync() if the library is built with W5500_SPI_ISR_FORWARDED. */
+#ifndef W5500_SPI_ISR
+ISR(SPI_STC_vect)
+{
+    W5500::handleTransferInterrupt();
+}
+#endif
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+
+    W5500 chip = W5500("00-08-dc-ff-ff-ff", "192.168.178.1", "255.255.255.0", "192.168.178.101");
+
+    TcpSocket socket;
+    socket.bind(&chip, 1000);
+    socket.open();
+    socket.listen();
+
+    const unsigned char peerAddress[4] = {192, 168, 178, 2};
+    simulator.establishConnection(socket.getIndex(), peerAddress, 50000);
+    chip.handleInterrupt();
+
+    static unsigned char payload[1024];
+    for (uint16_t i = 0; i < sizeof(payload); i++)
+    {
+        payload[i] = static_cast<unsigned char>(i);
+    }
+
+    simulator.takeTransmittedData(socket.getIndex());
+    simulator.resetStatistics();
+
+    constexpr uint16_t iterationCount = 64;
+    for (uint16_t i = 0; i < iterationCount; i++)
+    {
+        uint16_t queuedByteCount = 0;
+
+        /* sendAsync() queues nothing until SEND_OK and free space are seen. */
+        while (queuedByteCount < sizeof(payload))
+        {
+            queuedByteCount += socket.sendAsync(payload + queuedByteCount, sizeof(payload) - queuedByteCount);
+        }
+    }
+
+    const W5500Simulator::Statistics& statistics = simulator.getStatistics();
+    const unsigned long payloadByteCount = simulator.takeTransmittedData(socket.getIndex()).size();
+
+    printf("payload bytes:  %lu\n", payloadByteCount);
+    printf("SPI frames:     %lu\n", static_cast<unsigned long>(statistics.frameCount));
+    printf("SPI bytes:      %lu\n", static_cast<unsigned long>(statistics.byteCount));
+    printf("SPI efficiency: %.3f\n", static_cast<double>(payloadByteCount) / statistics.byteCount);
+
+    return 0;
+}
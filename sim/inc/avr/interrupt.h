@@ -0,0 +1,39 @@
+/**
+ *  \file   interrupt.h
+ *  \brief  Host replacement for the avr-libc interrupt definitions.
+ *
+ *  ISR() declares a plain C function. The simulated SPI peripheral calls
+ *  the SPI_STC_vect handler whenever SPIE, SPIF and the I bit of SREG are
+ *  set at the same time. The simulated chip doesn't drive INTn, so host
+ *  programs call an INT0_vect handler themselves.
+ */
+
+#ifndef __HOST_AVR_INTERRUPT_H__
+#define __HOST_AVR_INTERRUPT_H__
+
+#include "io.h"
+
+#define ISR(vector, ...) extern "C" void vector(void)
+
+#define SPI_STC_vect __vector_spi_stc
+#define INT0_vect    __vector_int0
+
+/**
+ *  \fn     sei(void)
+ *  \brief  Sets the global interrupt enable bit.
+ */
+inline void sei(void)
+{
+    SREG |= (1 << SREG_I);
+}
+
+/**
+ *  \fn     cli(void)
+ *  \brief  Clears the global interrupt enable bit.
+ */
+inline void cli(void)
+{
+    SREG &= ~(1 << SREG_I);
+}
+
+#endif //__HOST_AVR_INTERRUPT_H__
@@ -0,0 +1,63 @@
+/**
+ *  \file   io.h
+ *  \brief  Host replacement for the avr-libc I/O register definitions.
+ *
+ *  Only the registers used by the W5500_AVR library and its examples are
+ *  provided. The SPI registers are backed by the simulated W5500, the port
+ *  and external interrupt registers are plain bytes and TCNT1 is a plain
+ *  word host programs may advance to stamp trace records.
+ */
+
+#ifndef __HOST_AVR_IO_H__
+#define __HOST_AVR_IO_H__
+
+#include <stdint.h>
+
+#include "../../src/host_spi/host_register.hpp"
+
+extern volatile unsigned char DDRA;
+extern volatile unsigned char DDRB;
+extern volatile unsigned char DDRC;
+extern volatile unsigned char DDRD;
+
+extern volatile unsigned char PORTA;
+extern volatile unsigned char PORTB;
+extern volatile unsigned char PORTC;
+extern volatile unsigned char PORTD;
+
+extern volatile unsigned char PINA;
+extern volatile unsigned char PINB;
+extern volatile unsigned char PINC;
+extern volatile unsigned char PIND;
+
+extern volatile uint16_t TCNT1;
+
+extern volatile unsigned char EICRA;
+extern volatile unsigned char EIMSK;
+
+extern HostRegister SREG;
+extern HostRegister SPCR;
+extern HostRegister SPSR;
+extern HostDataRegister SPDR;
+
+#define SREG_I 7
+
+#define SPIE 7
+#define SPE  6
+#define DORD 5
+#define MSTR 4
+#define CPOL 3
+#define CPHA 2
+#define SPR1 1
+#define SPR0 0
+
+#define ISC01 1
+#define ISC00 0
+
+#define INT0 0
+
+#define SPIF  7
+#define WCOL  6
+#define SPI2X 0
+
+#endif //__HOST_AVR_IO_H__
@@ -0,0 +1,15 @@
+/**
+ *  \file   avr_spi.hpp
+ *  \brief  Host replacement for the include file of the AVR_SPI library.
+ *
+ *  The classes keep the interface of AVR_SPI but transfer every byte to the
+ *  simulated W5500 instead of the SPI peripheral.
+ */
+
+#ifndef __HOST_AVR_SPI_HPP__
+#define __HOST_AVR_SPI_HPP__
+
+#include "../src/host_spi/spi_bus.hpp"
+#include "../src/host_spi/spi_device.hpp"
+
+#endif //__HOST_AVR_SPI_HPP__
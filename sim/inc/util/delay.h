@@ -0,0 +1,15 @@
+/**
+ *  \file   delay.h
+ *  \brief  Host replacement for the avr-libc busy wait functions.
+ *
+ *  The simulated W5500 reacts instantly, so both delays return immediately.
+ */
+
+#ifndef __HOST_UTIL_DELAY_H__
+#define __HOST_UTIL_DELAY_H__
+
+inline void _delay_ms(double) {}
+
+inline void _delay_us(double) {}
+
+#endif //__HOST_UTIL_DELAY_H__
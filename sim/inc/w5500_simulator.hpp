@@ -0,0 +1,14 @@
+/**
+ *  \file   w5500_simulator.hpp
+ *  \brief  This is the include file for the W5500 host simulation.
+ *
+ *  Include this file in host programs that script the simulated W5500, for
+ *  example to inject connections and data or to inspect transmitted data.
+ */
+
+#ifndef __W5500_SIMULATOR_HPP__
+#define __W5500_SIMULATOR_HPP__
+
+#include "../src/chip_model/w5500_simulator.hpp"
+
+#endif //__W5500_SIMULATOR_HPP__
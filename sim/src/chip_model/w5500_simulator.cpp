@@ -0,0 +1,622 @@
+/**
+ *  \file   w5500_simulator.cpp
+ *  \brief  The file contains implementation for the W5500Simulator class.
+ */
+
+#include "w5500_simulator.hpp"
+
+#include <string.h>
+
+namespace
+{
+constexpr uint16_t MR = 0x0000;
+constexpr uint16_t SIR = 0x0017;
+constexpr uint16_t SIMR = 0x0018;
+constexpr uint16_t IR = 0x0015;
+constexpr uint16_t IMR = 0x0016;
+constexpr uint16_t PHYCFGR = 0x002e;
+constexpr uint16_t VERSIONR = 0x0039;
+
+constexpr uint16_t SnMR = 0x0000;
+constexpr uint16_t SnCR = 0x0001;
+constexpr uint16_t SnIR = 0x0002;
+constexpr uint16_t SnSR = 0x0003;
+constexpr uint16_t SnDIPR = 0x000c;
+constexpr uint16_t SnDPORT = 0x0010;
+constexpr uint16_t SnRXBUFSIZE = 0x001e;
+constexpr uint16_t SnTXBUFSIZE = 0x001f;
+constexpr uint16_t SnTXFSR = 0x0020;
+constexpr uint16_t SnTXRD = 0x0022;
+constexpr uint16_t SnTXWR = 0x0024;
+constexpr uint16_t SnRXRSR = 0x0026;
+constexpr uint16_t SnRXRD = 0x0028;
+constexpr uint16_t SnRXWR = 0x002a;
+constexpr uint16_t SnIMR = 0x002c;
+
+constexpr unsigned char IR_CON = 0x01;
+constexpr unsigned char IR_DISCON = 0x02;
+constexpr unsigned char IR_RECV = 0x04;
+constexpr unsigned char IR_TIMEOUT = 0x08;
+constexpr unsigned char IR_SENDOK = 0x10;
+
+constexpr unsigned char SOCK_CLOSED = 0x00;
+constexpr unsigned char SOCK_INIT = 0x13;
+constexpr unsigned char SOCK_LISTEN = 0x14;
+constexpr unsigned char SOCK_SYNSENT = 0x15;
+constexpr unsigned char SOCK_ESTABLISHED = 0x17;
+constexpr unsigned char SOCK_CLOSE_WAIT = 0x1c;
+constexpr unsigned char SOCK_UDP = 0x22;
+constexpr unsigned char SOCK_MACRAW = 0x42;
+} // namespace
+
+W5500Simulator& W5500Simulator::getInstance(void)
+{
+    static W5500Simulator instance;
+    return instance;
+}
+
+W5500Simulator::W5500Simulator(void)
+{
+    reset();
+}
+
+void W5500Simulator::reset(void)
+{
+    memset(_txBuffers, 0x00, sizeof(_txBuffers));
+    memset(_rxBuffers, 0x00, sizeof(_rxBuffers));
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        _transmittedData[i].clear();
+    }
+
+    _isSelected = false;
+    _framePosition = 0;
+    _isSendCompletionDeferred = false;
+    _isCommonWriteDropped = false;
+    _phyModePins = 0x07;
+    resetRegisters();
+    resetStatistics();
+}
+
+void W5500Simulator::resetRegisters(void)
+{
+    _sendInFlightMask = 0x00;
+    memset(_commonRegisters, 0x00, sizeof(_commonRegisters));
+    _commonRegisters[0x19] = 0x07;
+    _commonRegisters[0x1a] = 0xd0;
+    _commonRegisters[0x1b] = 0x08;
+    _commonRegisters[0x1c] = 0x28;
+    _commonRegisters[PHYCFGR] = 0x87 | (_phyModePins << 3);
+    _commonRegisters[VERSIONR] = 0x04;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        unsigned char* socketRegisters = _socketRegisters[i];
+
+        memset(socketRegisters, 0x00, sizeof(_socketRegisters[i]));
+        memset(socketRegisters + 0x0006, 0xff, 6);
+        socketRegisters[0x0016] = 0x80;
+        socketRegisters[SnRXBUFSIZE] = 0x02;
+        socketRegisters[SnTXBUFSIZE] = 0x02;
+        socketRegisters[SnIMR] = 0xff;
+        socketRegisters[0x002d] = 0x40;
+    }
+}
+
+void W5500Simulator::select(void)
+{
+    _isSelected = true;
+    _framePosition = 0;
+    _statistics.chipSelectCount++;
+}
+
+void W5500Simulator::deselect(void)
+{
+    if (_isSelected && _framePosition >= 3)
+    {
+        _statistics.frameCount++;
+    }
+
+    _isSelected = false;
+    _framePosition = 0;
+}
+
+unsigned char W5500Simulator::exchangeByte(const unsigned char& mosiByte)
+{
+    _statistics.byteCount++;
+
+    if (!_isSelected)
+    {
+        return 0xff;
+    }
+
+    if (0 == _framePosition)
+    {
+        _frameAddress = static_cast<uint16_t>(mosiByte) << 8;
+        _framePosition++;
+        return 0x00;
+    }
+
+    if (1 == _framePosition)
+    {
+        _frameAddress |= mosiByte;
+        _framePosition++;
+        return 0x00;
+    }
+
+    if (2 == _framePosition)
+    {
+        _frameControl = mosiByte;
+        _framePosition++;
+        return 0x00;
+    }
+
+    const uint16_t dataIndex = _framePosition - 3;
+    const uint16_t address = _frameAddress + dataIndex;
+    const unsigned char blockSelect = _frameControl >> 3;
+
+    unsigned char misoByte = 0x00;
+
+    if (_frameControl & 0x04)
+    {
+        writeByte(blockSelect, address, mosiByte);
+    }
+    else
+    {
+        misoByte = readByte(blockSelect, address);
+    }
+
+    _statistics.dataByteCount++;
+    _framePosition++;
+
+    const unsigned char operationMode = _frameControl & 0x03;
+
+    if (operationMode)
+    {
+        const uint16_t fixedLength = 0x03 == operationMode ? 4 : operationMode;
+
+        if (dataIndex + 1 == fixedLength)
+        {
+            _statistics.frameCount++;
+            _framePosition = 0;
+        }
+    }
+
+    return misoByte;
+}
+
+unsigned char W5500Simulator::readByte(const unsigned char& blockSelect, const uint16_t& address)
+{
+    if (0 == blockSelect)
+    {
+        if (SIR == address)
+        {
+            unsigned char socketInterrupts = 0x00;
+
+            for (uint8_t i = 0; i < 8; i++)
+            {
+                if (_socketRegisters[i][SnIR])
+                {
+                    socketInterrupts |= (1 << i);
+                }
+            }
+
+            return socketInterrupts;
+        }
+
+        return address < sizeof(_commonRegisters) ? _commonRegisters[address] : 0x00;
+    }
+
+    const uint8_t socket = blockSelect >> 2;
+
+    switch (blockSelect & 0x03)
+    {
+    case 0x01:
+        switch (address)
+        {
+        case SnTXFSR:
+            return getTXFreeSize(socket) >> 8;
+        case SnTXFSR + 1:
+            return getTXFreeSize(socket) & 0xff;
+        case SnRXRSR:
+            return getRXReceivedSize(socket) >> 8;
+        case SnRXRSR + 1:
+            return getRXReceivedSize(socket) & 0xff;
+        default:
+            return address < sizeof(_socketRegisters[socket]) ? _socketRegisters[socket][address] : 0x00;
+        }
+    case 0x02:
+        return getTXBufferSize(socket) ? _txBuffers[socket][address & (getTXBufferSize(socket) - 1)]
+                                       : 0x00;
+    case 0x03:
+        return getRXBufferSize(socket) ? _rxBuffers[socket][address & (getRXBufferSize(socket) - 1)]
+                                       : 0x00;
+    default:
+        return 0x00;
+    }
+}
+
+void W5500Simulator::writeByte(const unsigned char& blockSelect,
+                               const uint16_t& address,
+                               const unsigned char& value)
+{
+    if (0 == blockSelect)
+    {
+        if (MR == address && (value & 0x80))
+        {
+            resetRegisters();
+        }
+        else if (_isCommonWriteDropped)
+        {
+            return;
+        }
+        else if (PHYCFGR == address)
+        {
+            _commonRegisters[PHYCFGR] = value | 0x07;
+        }
+        else if (IR == address)
+        {
+            _commonRegisters[IR] &= ~value;
+        }
+        else if (address < VERSIONR && SIR != address)
+        {
+            _commonRegisters[address] = value;
+        }
+
+        return;
+    }
+
+    const uint8_t socket = blockSelect >> 2;
+
+    switch (blockSelect & 0x03)
+    {
+    case 0x01:
+        switch (address)
+        {
+        case SnCR:
+            executeCommand(socket, value);
+            break;
+        case SnIR:
+            _socketRegisters[socket][SnIR] &= ~value;
+            break;
+        case SnSR:
+        case SnTXFSR:
+        case SnTXFSR + 1:
+        case SnTXRD:
+        case SnTXRD + 1:
+        case SnRXRSR:
+        case SnRXRSR + 1:
+        case SnRXWR:
+        case SnRXWR + 1:
+            break;
+        default:
+            if (address < sizeof(_socketRegisters[socket]))
+            {
+                _socketRegisters[socket][address] = value;
+            }
+            break;
+        }
+        break;
+    case 0x02:
+        if (getTXBufferSize(socket))
+        {
+            _txBuffers[socket][address & (getTXBufferSize(socket) - 1)] = value;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void W5500Simulator::executeCommand(const uint8_t& socket, const unsigned char& command)
+{
+    unsigned char* socketRegisters = _socketRegisters[socket];
+    const unsigned char status = socketRegisters[SnSR];
+
+    if (0x01 == command || 0x08 == command || 0x10 == command)
+    {
+        _sendInFlightMask &= ~(1 << socket);
+    }
+
+    switch (command)
+    {
+    case 0x01: /* OPEN */
+        switch (socketRegisters[SnMR] & 0x0f)
+        {
+        case 0x01:
+            socketRegisters[SnSR] = SOCK_INIT;
+            break;
+        case 0x02:
+            socketRegisters[SnSR] = SOCK_UDP;
+            break;
+        case 0x04:
+            socketRegisters[SnSR] = 0 == socket ? SOCK_MACRAW : SOCK_CLOSED;
+            break;
+        default:
+            socketRegisters[SnSR] = SOCK_CLOSED;
+            break;
+        }
+
+        setSocketWord(socket, SnTXRD, 0);
+        setSocketWord(socket, SnTXWR, 0);
+        setSocketWord(socket, SnRXRD, 0);
+        setSocketWord(socket, SnRXWR, 0);
+        break;
+    case 0x02: /* LISTEN */
+        if (SOCK_INIT == status)
+        {
+            socketRegisters[SnSR] = SOCK_LISTEN;
+        }
+        break;
+    case 0x04: /* CONNECT */
+        if (SOCK_INIT == status)
+        {
+            socketRegisters[SnSR] = SOCK_SYNSENT;
+        }
+        break;
+    case 0x08: /* DISCON */
+        if (SOCK_ESTABLISHED == status || SOCK_CLOSE_WAIT == status)
+        {
+            socketRegisters[SnSR] = SOCK_CLOSED;
+            raiseInterrupt(socket, IR_DISCON);
+        }
+        break;
+    case 0x10: /* CLOSE */
+        socketRegisters[SnSR] = SOCK_CLOSED;
+        break;
+    case 0x20: /* SEND */
+    case 0x21: /* SEND_MAC */
+        if (SOCK_ESTABLISHED == status || SOCK_CLOSE_WAIT == status || SOCK_UDP == status
+            || SOCK_MACRAW == status)
+        {
+            if (_sendInFlightMask & (1 << socket))
+            {
+                _statistics.overlappedSendCount++;
+            }
+
+            if (_isSendCompletionDeferred)
+            {
+                _sendInFlightMask |= (1 << socket);
+                _sendEndPointers[socket] = getSocketWord(socket, SnTXWR);
+            }
+            else
+            {
+                transmit(socket, getSocketWord(socket, SnTXWR));
+            }
+
+            _statistics.sendCommandCount++;
+        }
+        break;
+    case 0x40: /* RECV */
+        _statistics.recvCommandCount++;
+        break;
+    default:
+        break;
+    }
+
+    socketRegisters[SnCR] = 0x00;
+}
+
+void W5500Simulator::transmit(const uint8_t& socket, const uint16_t& writePointer)
+{
+    const uint16_t bufferSize = getTXBufferSize(socket);
+
+    for (uint16_t readPointer = getSocketWord(socket, SnTXRD); readPointer != writePointer; readPointer++)
+    {
+        _transmittedData[socket].push_back(_txBuffers[socket][readPointer & (bufferSize - 1)]);
+    }
+
+    setSocketWord(socket, SnTXRD, writePointer);
+    raiseInterrupt(socket, IR_SENDOK);
+}
+
+void W5500Simulator::setSendCompletionDeferred(const bool& isDeferred)
+{
+    _isSendCompletionDeferred = isDeferred;
+}
+
+void W5500Simulator::setPhyModePins(const uint8_t& mode)
+{
+    _phyModePins = mode & 0x07;
+}
+
+void W5500Simulator::setCommonWritesDropped(const bool& isDropped)
+{
+    _isCommonWriteDropped = isDropped;
+}
+
+bool W5500Simulator::completeSend(const uint8_t& socket)
+{
+    if (!(_sendInFlightMask & (1 << socket)))
+    {
+        return false;
+    }
+
+    _sendInFlightMask &= ~(1 << socket);
+    transmit(socket, _sendEndPointers[socket]);
+    return true;
+}
+
+void W5500Simulator::raiseInterrupt(const uint8_t& socket, const unsigned char& flags)
+{
+    _socketRegisters[socket][SnIR] |= flags & _socketRegisters[socket][SnIMR];
+}
+
+bool W5500Simulator::establishConnection(const uint8_t& socket,
+                                         const unsigned char peerAddress[4],
+                                         const uint16_t& peerPort)
+{
+    unsigned char* socketRegisters = _socketRegisters[socket];
+
+    if (SOCK_LISTEN != socketRegisters[SnSR] && SOCK_SYNSENT != socketRegisters[SnSR])
+    {
+        return false;
+    }
+
+    memcpy(socketRegisters + SnDIPR, peerAddress, 4);
+    setSocketWord(socket, SnDPORT, peerPort);
+
+    socketRegisters[SnSR] = SOCK_ESTABLISHED;
+    raiseInterrupt(socket, IR_CON);
+    return true;
+}
+
+uint16_t W5500Simulator::injectData(const uint8_t& socket, const unsigned char* data, const uint16_t& length)
+{
+    const unsigned char status = _socketRegisters[socket][SnSR];
+
+    if (SOCK_ESTABLISHED != status)
+    {
+        return 0;
+    }
+
+    const uint16_t freeSize = getRXBufferSize(socket) - getRXReceivedSize(socket);
+    const uint16_t acceptedLength = length < freeSize ? length : freeSize;
+
+    if (acceptedLength)
+    {
+        writeToRXBuffer(socket, data, acceptedLength);
+        raiseInterrupt(socket, IR_RECV);
+    }
+
+    return acceptedLength;
+}
+
+bool W5500Simulator::injectDatagram(const uint8_t& socket,
+                                    const unsigned char peerAddress[4],
+                                    const uint16_t& peerPort,
+                                    const unsigned char* data,
+                                    const uint16_t& length)
+{
+    if (SOCK_UDP != _socketRegisters[socket][SnSR])
+    {
+        return false;
+    }
+
+    const uint16_t freeSize = getRXBufferSize(socket) - getRXReceivedSize(socket);
+
+    if (static_cast<uint32_t>(length) + 8 > freeSize)
+    {
+        return false;
+    }
+
+    const unsigned char header[8] = {peerAddress[0],
+                                     peerAddress[1],
+                                     peerAddress[2],
+                                     peerAddress[3],
+                                     static_cast<unsigned char>(peerPort >> 8),
+                                     static_cast<unsigned char>(peerPort & 0xff),
+                                     static_cast<unsigned char>(length >> 8),
+                                     static_cast<unsigned char>(length & 0xff)};
+
+    writeToRXBuffer(socket, header, 8);
+    writeToRXBuffer(socket, data, length);
+    raiseInterrupt(socket, IR_RECV);
+    return true;
+}
+
+void W5500Simulator::closeConnection(const uint8_t& socket)
+{
+    if (SOCK_ESTABLISHED == _socketRegisters[socket][SnSR])
+    {
+        _socketRegisters[socket][SnSR] = SOCK_CLOSE_WAIT;
+        raiseInterrupt(socket, IR_DISCON);
+    }
+}
+
+void W5500Simulator::timeOutConnection(const uint8_t& socket)
+{
+    _sendInFlightMask &= ~(1 << socket);
+    _socketRegisters[socket][SnSR] = SOCK_CLOSED;
+    raiseInterrupt(socket, IR_TIMEOUT);
+}
+
+std::vector<unsigned char> W5500Simulator::takeTransmittedData(const uint8_t& socket)
+{
+    std::vector<unsigned char> transmittedData;
+    transmittedData.swap(_transmittedData[socket]);
+    return transmittedData;
+}
+
+bool W5500Simulator::isInterruptAsserted(void) const
+{
+    unsigned char socketInterrupts = 0x00;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        if (_socketRegisters[i][SnIR])
+        {
+            socketInterrupts |= (1 << i);
+        }
+    }
+
+    return (socketInterrupts & _commonRegisters[SIMR]) || (_commonRegisters[IR] & _commonRegisters[IMR]);
+}
+
+unsigned char W5500Simulator::getCommonRegister(const uint16_t& address) const
+{
+    return address < sizeof(_commonRegisters) ? _commonRegisters[address] : 0x00;
+}
+
+unsigned char W5500Simulator::getSocketRegister(const uint8_t& socket, const uint16_t& address) const
+{
+    return address < sizeof(_socketRegisters[socket]) ? _socketRegisters[socket][address] : 0x00;
+}
+
+const W5500Simulator::Statistics& W5500Simulator::getStatistics(void) const
+{
+    return _statistics;
+}
+
+void W5500Simulator::resetStatistics(void)
+{
+    _statistics = {};
+}
+
+void W5500Simulator::writeToRXBuffer(const uint8_t& socket, const unsigned char* data, const uint16_t& length)
+{
+    const uint16_t bufferMask = getRXBufferSize(socket) - 1;
+    uint16_t writePointer = getSocketWord(socket, SnRXWR);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        _rxBuffers[socket][writePointer & bufferMask] = data[i];
+        writePointer++;
+    }
+
+    setSocketWord(socket, SnRXWR, writePointer);
+}
+
+uint16_t W5500Simulator::getSocketWord(const uint8_t& socket, const uint16_t& address) const
+{
+    return (static_cast<uint16_t>(_socketRegisters[socket][address]) << 8) + _socketRegisters[socket][address + 1];
+}
+
+void W5500Simulator::setSocketWord(const uint8_t& socket, const uint16_t& address, const uint16_t& value)
+{
+    _socketRegisters[socket][address] = static_cast<unsigned char>(value >> 8);
+    _socketRegisters[socket][address + 1] = static_cast<unsigned char>(value & 0xff);
+}
+
+uint16_t W5500Simulator::getTXBufferSize(const uint8_t& socket) const
+{
+    const unsigned char sizeInKilobytes = _socketRegisters[socket][SnTXBUFSIZE];
+    return sizeInKilobytes > 16 ? 0 : static_cast<uint16_t>(sizeInKilobytes) << 10;
+}
+
+uint16_t W5500Simulator::getRXBufferSize(const uint8_t& socket) const
+{
+    const unsigned char sizeInKilobytes = _socketRegisters[socket][SnRXBUFSIZE];
+    return sizeInKilobytes > 16 ? 0 : static_cast<uint16_t>(sizeInKilobytes) << 10;
+}
+
+uint16_t W5500Simulator::getTXFreeSize(const uint8_t& socket) const
+{
+    return getTXBufferSize(socket) - static_cast<uint16_t>(getSocketWord(socket, SnTXWR) - getSocketWord(socket, SnTXRD));
+}
+
+uint16_t W5500Simulator::getRXReceivedSize(const uint8_t& socket) const
+{
+    return getSocketWord(socket, SnRXWR) - getSocketWord(socket, SnRXRD);
+}
@@ -0,0 +1,371 @@
+/**
+ *  \file   w5500_simulator.hpp
+ *  \brief  The file contains declaration for the W5500Simulator class.
+ */
+
+#ifndef __W5500_SIMULATOR_MODEL_HPP__
+#define __W5500_SIMULATOR_MODEL_HPP__
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ *  \class  W5500Simulator
+ *  \brief  The class models a W5500 on register level for host builds.
+ *
+ *  The model decodes SPI frames in variable and fixed length data mode and
+ *  covers the common registers, the eight socket register blocks and the
+ *  16 KB TX and RX buffer memories with pointer wraparound. Socket commands
+ *  change Sn_SR and raise Sn_IR like the chip does. The network side is
+ *  replaced by a scriptable peer: test code injects connections, data and
+ *  disconnects and collects whatever the driver transmitted.
+ */
+class W5500Simulator
+{
+public:
+    /**
+     *  \struct Statistics
+     *  \brief  Counters of the SPI traffic seen by the simulated chip.
+     */
+    struct Statistics
+    {
+        uint32_t frameCount;
+        uint32_t byteCount;
+        uint32_t dataByteCount;
+        uint32_t chipSelectCount;
+        uint32_t sendCommandCount;
+        uint32_t recvCommandCount;
+        uint32_t overlappedSendCount;
+    };
+
+    /**
+     *  \fn     getInstance(void)
+     *  \brief  Returns the simulated chip attached to the host SPI bus.
+     *  \return Reference to the single simulator instance.
+     */
+    static W5500Simulator& getInstance(void);
+
+    /**
+     *  \fn     reset(void)
+     *  \brief  Performs a power-on reset of registers, buffers and the peer.
+     */
+    void reset(void);
+
+    /**
+     *  \fn     select(void)
+     *  \brief  Starts a new frame as SCSn is pulled low.
+     */
+    void select(void);
+
+    /**
+     *  \fn     deselect(void)
+     *  \brief  Ends the current frame as SCSn is released.
+     */
+    void deselect(void);
+
+    /**
+     *  \fn         exchangeByte(const unsigned char& mosiByte)
+     *  \brief      Shifts one byte in and out of the simulated chip.
+     *  \param[in]  mosiByte passes the byte sent by the master.
+     *  \return     The byte returned on MISO.
+     */
+    unsigned char exchangeByte(const unsigned char& mosiByte);
+
+    /**
+     *  \fn         establishConnection()
+     *  \brief      Lets the peer complete a TCP handshake with the socket.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  peerAddress passes the four byte IPv4 address of the peer.
+     *  \param[in]  peerPort passes the port of the peer.
+     *  \return     Boolean indicating whether the socket was listening or connecting.
+     */
+    bool establishConnection(const uint8_t& socket,
+                             const unsigned char peerAddress[4],
+                             const uint16_t& peerPort);
+
+    /**
+     *  \fn         injectData()
+     *  \brief      Lets the peer send data on an established TCP connection.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  data passes the payload.
+     *  \param[in]  length passes the length of the payload.
+     *  \return     Number of bytes accepted by the socket's RX buffer.
+     */
+    uint16_t injectData(const uint8_t& socket, const unsigned char* data, const uint16_t& length);
+
+    /**
+     *  \fn         injectDatagram()
+     *  \brief      Lets the peer send a datagram to a UDP socket.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  peerAddress passes the four byte IPv4 address of the peer.
+     *  \param[in]  peerPort passes the port of the peer.
+     *  \param[in]  data passes the payload.
+     *  \param[in]  length passes the length of the payload.
+     *  \return     Boolean indicating whether the datagram fit into the RX buffer.
+     */
+    bool injectDatagram(const uint8_t& socket,
+                        const unsigned char peerAddress[4],
+                        const uint16_t& peerPort,
+                        const unsigned char* data,
+                        const uint16_t& length);
+
+    /**
+     *  \fn         closeConnection(const uint8_t& socket)
+     *  \brief      Lets the peer close the TCP connection (FIN received).
+     *  \param[in]  socket passes the index of the socket.
+     */
+    void closeConnection(const uint8_t& socket);
+
+    /**
+     *  \fn         timeOutConnection(const uint8_t& socket)
+     *  \brief      Lets the socket's ARP or TCP retransmission time out.
+     *  \param[in]  socket passes the index of the socket.
+     */
+    void timeOutConnection(const uint8_t& socket);
+
+    /**
+     *  \fn         setSendCompletionDeferred(const bool& isDeferred)
+     *  \brief      Selects whether SEND completes at once or on completeSend().
+     *  \param[in]  isDeferred passes true to let test code decide when SEND_OK is raised.
+     *
+     *  While a deferred SEND is in flight, Sn_TX_RD isn't advanced, so the
+     *  sent data still occupies Sn_TX_FSR like on the wire. A SEND issued
+     *  before SEND_OK is counted as overlapped send.
+     */
+    void setSendCompletionDeferred(const bool& isDeferred);
+
+    /**
+     *  \fn         completeSend(const uint8_t& socket)
+     *  \brief      Finishes the socket's deferred SEND and raises SEND_OK.
+     *  \param[in]  socket passes the index of the socket.
+     *  \return     Boolean indicating whether a SEND was in flight.
+     */
+    bool completeSend(const uint8_t& socket);
+
+    /**
+     *  \fn         setPhyModePins(const uint8_t& mode)
+     *  \brief      Straps the PMODE pins, which the reset loads into PHYCFGR's OPMDC bits.
+     *  \param[in]  mode passes the 3 bit operation mode, 0x07 for all capable auto-negotiation.
+     */
+    void setPhyModePins(const uint8_t& mode);
+
+    /**
+     *  \fn         setCommonWritesDropped(const bool& isDropped)
+     *  \brief      Lets writes to common registers other than MR get lost on the bus.
+     *  \param[in]  isDropped passes true to ignore the writes, e.g. to fail a verification.
+     */
+    void setCommonWritesDropped(const bool& isDropped);
+
+    /**
+     *  \fn         takeTransmittedData(const uint8_t& socket)
+     *  \brief      Returns and clears the data the socket sent to the peer.
+     *  \param[in]  socket passes the index of the socket.
+     *  \return     The transmitted bytes in order of the SEND commands.
+     */
+    std::vector<unsigned char> takeTransmittedData(const uint8_t& socket);
+
+    /**
+     *  \fn     isInterruptAsserted(void) const
+     *  \brief  Returns the state of the active low INTn pin.
+     *  \return Boolean indicating that INTn is driven low.
+     */
+    bool isInterruptAsserted(void) const;
+
+    /**
+     *  \fn         getCommonRegister(const uint16_t& address) const
+     *  \brief      Returns a common register byte without SPI traffic.
+     *  \param[in]  address passes the offset of the register.
+     *  \return     The register content.
+     */
+    unsigned char getCommonRegister(const uint16_t& address) const;
+
+    /**
+     *  \fn         getSocketRegister(const uint8_t& socket, const uint16_t& address) const
+     *  \brief      Returns a socket register byte without SPI traffic.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  address passes the offset of the register.
+     *  \return     The register content.
+     */
+    unsigned char getSocketRegister(const uint8_t& socket, const uint16_t& address) const;
+
+    /**
+     *  \fn     getStatistics(void) const
+     *  \brief  Returns the SPI traffic counters.
+     *  \return Reference to the counters.
+     */
+    const Statistics& getStatistics(void) const;
+
+    /**
+     *  \fn     resetStatistics(void)
+     *  \brief  Clears the SPI traffic counters.
+     */
+    void resetStatistics(void);
+
+private:
+    /**
+     *  \fn     W5500Simulator(void)
+     *  \brief  The constructor initializes the chip in its reset state.
+     */
+    W5500Simulator(void);
+
+    /**
+     *  \fn     resetRegisters(void)
+     *  \brief  Restores the reset values of all registers.
+     */
+    void resetRegisters(void);
+
+    /**
+     *  \fn         readByte(const unsigned char& blockSelect, const uint16_t& address)
+     *  \brief      Reads a byte of the selected block as the chip would.
+     *  \param[in]  blockSelect passes the BSB bits of the control byte.
+     *  \param[in]  address passes the offset within the block.
+     *  \return     The byte to return on MISO.
+     */
+    unsigned char readByte(const unsigned char& blockSelect, const uint16_t& address);
+
+    /**
+     *  \fn         writeByte()
+     *  \brief      Writes a byte of the selected block and runs its side effects.
+     *  \param[in]  blockSelect passes the BSB bits of the control byte.
+     *  \param[in]  address passes the offset within the block.
+     *  \param[in]  value passes the byte received on MOSI.
+     */
+    void writeByte(const unsigned char& blockSelect, const uint16_t& address, const unsigned char& value);
+
+    /**
+     *  \fn         executeCommand(const uint8_t& socket, const unsigned char& command)
+     *  \brief      Executes a command written to Sn_CR.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  command passes the command value.
+     */
+    void executeCommand(const uint8_t& socket, const unsigned char& command);
+
+    /**
+     *  \fn         raiseInterrupt(const uint8_t& socket, const unsigned char& flags)
+     *  \brief      Sets the Sn_IR bits enabled by Sn_IMR.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  flags passes the interrupt bits to set.
+     */
+    void raiseInterrupt(const uint8_t& socket, const unsigned char& flags);
+
+    /**
+     *  \fn         transmit(const uint8_t& socket, const uint16_t& writePointer)
+     *  \brief      Moves the TX data up to the passed pointer to the peer and raises SEND_OK.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  writePointer passes Sn_TX_WR at the time of SEND.
+     */
+    void transmit(const uint8_t& socket, const uint16_t& writePointer);
+
+    /**
+     *  \fn         writeToRXBuffer()
+     *  \brief      Appends data at Sn_RX_WR and advances the pointer.
+     *  \param[in]  socket passes the index of the socket.
+     *  \param[in]  data passes the data to append.
+     *  \param[in]  length passes the length of the data.
+     */
+    void writeToRXBuffer(const uint8_t& socket, const unsigned char* data, const uint16_t& length);
+
+    uint16_t getSocketWord(const uint8_t& socket, const uint16_t& address) const;
+
+    void setSocketWord(const uint8_t& socket, const uint16_t& address, const uint16_t& value);
+
+    uint16_t getTXBufferSize(const uint8_t& socket) const;
+
+    uint16_t getRXBufferSize(const uint8_t& socket) const;
+
+    uint16_t getTXFreeSize(const uint8_t& socket) const;
+
+    uint16_t getRXReceivedSize(const uint8_t& socket) const;
+
+    /**
+     *  \var    _commonRegisters
+     *  \brief  The common register block 0x0000 - 0x0039.
+     */
+    unsigned char _commonRegisters[0x40];
+
+    /**
+     *  \var    _socketRegisters
+     *  \brief  The eight socket register blocks 0x0000 - 0x002F.
+     */
+    unsigned char _socketRegisters[8][0x30];
+
+    /**
+     *  \var    _txBuffers
+     *  \brief  The TX memory of each socket, masked by Sn_TXBUF_SIZE.
+     */
+    unsigned char _txBuffers[8][0x4000];
+
+    /**
+     *  \var    _rxBuffers
+     *  \brief  The RX memory of each socket, masked by Sn_RXBUF_SIZE.
+     */
+    unsigned char _rxBuffers[8][0x4000];
+
+    /**
+     *  \var    _transmittedData
+     *  \brief  The data each socket sent to the peer.
+     */
+    std::vector<unsigned char> _transmittedData[8];
+
+    /**
+     *  \var    _isSendCompletionDeferred
+     *  \brief  Indicates that SEND_OK is raised by completeSend() only.
+     */
+    bool _isSendCompletionDeferred = false;
+
+    /**
+     *  \var    _phyModePins
+     *  \brief  The operation mode strapped by the PMODE pins.
+     */
+    uint8_t _phyModePins = 0x07;
+
+    /**
+     *  \var    _isCommonWriteDropped
+     *  \brief  Indicates that writes to common registers other than MR are ignored.
+     */
+    bool _isCommonWriteDropped = false;
+
+    /**
+     *  \var    _sendInFlightMask
+     *  \brief  Marks the sockets with a deferred SEND in flight.
+     */
+    uint8_t _sendInFlightMask = 0x00;
+
+    /**
+     *  \var    _sendEndPointers
+     *  \brief  Sn_TX_WR of the deferred SEND of each socket.
+     */
+    uint16_t _sendEndPointers[8] = {};
+
+    /**
+     *  \var    _isSelected
+     *  \brief  Indicates a low SCSn.
+     */
+    bool _isSelected = false;
+
+    /**
+     *  \var    _framePosition
+     *  \brief  Index of the next byte within the current frame.
+     */
+    uint16_t _framePosition = 0;
+
+    /**
+     *  \var    _frameAddress
+     *  \brief  The address phase of the current frame.
+     */
+    uint16_t _frameAddress = 0;
+
+    /**
+     *  \var    _frameControl
+     *  \brief  The control phase of the current frame.
+     */
+    unsigned char _frameControl = 0;
+
+    /**
+     *  \var    _statistics
+     *  \brief  The SPI traffic counters.
+     */
+    Statistics _statistics = {};
+};
+
+#endif //__W5500_SIMULATOR_MODEL_HPP__
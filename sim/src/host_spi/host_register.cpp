@@ -0,0 +1,117 @@
+/**
+ *  \file   host_register.cpp
+ *  \brief  The file contains implementations for the simulated I/O registers.
+ */
+
+#include "host_register.hpp"
+
+#include "../chip_model/w5500_simulator.hpp"
+#include <avr/interrupt.h>
+#include <avr/io.h>
+
+volatile unsigned char DDRA = 0x00;
+volatile unsigned char DDRB = 0x00;
+volatile unsigned char DDRC = 0x00;
+volatile unsigned char DDRD = 0x00;
+
+volatile unsigned char PORTA = 0x00;
+volatile unsigned char PORTB = 0x00;
+volatile unsigned char PORTC = 0x00;
+volatile unsigned char PORTD = 0x00;
+
+volatile unsigned char PINA = 0x00;
+volatile unsigned char PINB = 0x00;
+volatile unsigned char PINC = 0x00;
+volatile unsigned char PIND = 0x00;
+
+volatile uint16_t TCNT1 = 0x0000;
+
+volatile unsigned char EICRA = 0x00;
+volatile unsigned char EIMSK = 0x00;
+
+HostRegister SREG(1 << SREG_I, &deliverSpiInterrupts);
+HostRegister SPCR(0x00, &deliverSpiInterrupts);
+HostRegister SPSR;
+HostDataRegister SPDR;
+
+/**
+ *  The library defines the real handler only with W5500_SPI_ISR, with
+ *  W5500_SPI_ISR_FORWARDED host programs define it themselves. This
+ *  fallback keeps all other host programs linkable.
+ */
+extern "C" __attribute__((weak)) void SPI_STC_vect(void) {}
+
+HostRegister::HostRegister(const unsigned char& initialValue, void (*onWrite)(void))
+    : _value(initialValue)
+    , _onWrite(onWrite)
+{
+}
+
+HostRegister& HostRegister::operator=(const unsigned char& value)
+{
+    _value = value;
+
+    if (_onWrite)
+    {
+        _onWrite();
+    }
+
+    return *this;
+}
+
+HostRegister& HostRegister::operator|=(const int& mask)
+{
+    return *this = static_cast<unsigned char>(_value | mask);
+}
+
+HostRegister& HostRegister::operator&=(const int& mask)
+{
+    return *this = static_cast<unsigned char>(_value & mask);
+}
+
+HostRegister::operator unsigned char(void) const
+{
+    return _value;
+}
+
+HostDataRegister& HostDataRegister::operator=(const unsigned char& value)
+{
+    SPSR &= ~(1 << SPIF);
+
+    _receivedByte = W5500Simulator::getInstance().exchangeByte(value);
+
+    SPSR |= (1 << SPIF);
+    deliverSpiInterrupts();
+
+    return *this;
+}
+
+HostDataRegister::operator unsigned char(void) const
+{
+    SPSR &= ~(1 << SPIF);
+    return _receivedByte;
+}
+
+void deliverSpiInterrupts(void)
+{
+    static bool isServicing = false;
+
+    if (isServicing)
+    {
+        return;
+    }
+
+    isServicing = true;
+
+    while ((SREG & (1 << SREG_I)) && (SPCR & (1 << SPIE)) && (SPSR & (1 << SPIF)))
+    {
+        SPSR &= ~(1 << SPIF);
+        SREG &= ~(1 << SREG_I);
+
+        SPI_STC_vect();
+
+        SREG |= (1 << SREG_I);
+    }
+
+    isServicing = false;
+}
@@ -0,0 +1,90 @@
+/**
+ *  \file   host_register.hpp
+ *  \brief  The file contains declarations for the simulated I/O registers.
+ */
+
+#ifndef __HOST_REGISTER_HPP__
+#define __HOST_REGISTER_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \class  HostRegister
+ *  \brief  The class represents an 8 bit I/O register with a write hook.
+ *
+ *  SREG and SPCR are modeled with this class. Every write calls the hook,
+ *  which lets the simulation deliver a pending SPI interrupt as soon as
+ *  SPIE or the global interrupt flag gets set.
+ */
+class HostRegister
+{
+public:
+    /**
+     *  \fn         HostRegister(const unsigned char& initialValue, void (*onWrite)(void))
+     *  \brief      The constructor initializes an instance of type 'HostRegister'.
+     *  \param[in]  initialValue passes the reset value of the register.
+     *  \param[in]  onWrite passes the function to call after every write.
+     */
+    explicit HostRegister(const unsigned char& initialValue = 0x00, void (*onWrite)(void) = nullptr);
+
+    HostRegister& operator=(const unsigned char& value);
+
+    /**
+     *  The compound operators take an int like the integer promoted operand
+     *  of 'SPCR &= ~(1 << SPIE)' and truncate it as the 8 bit register does.
+     */
+    HostRegister& operator|=(const int& mask);
+
+    HostRegister& operator&=(const int& mask);
+
+    operator unsigned char(void) const;
+
+private:
+    /**
+     *  \var    _value
+     *  \brief  The current content of the register.
+     */
+    unsigned char _value;
+
+    /**
+     *  \var    _onWrite
+     *  \brief  The function called after every write access.
+     */
+    void (*_onWrite)(void);
+};
+
+/**
+ *  \class  HostDataRegister
+ *  \brief  The class represents the SPI data register SPDR.
+ *
+ *  Writing the register exchanges one byte with the simulated W5500 and sets
+ *  SPIF. Reading it returns the byte received by the last exchange. Both
+ *  accesses clear a pending SPIF first, like the hardware does after SPSR
+ *  was read.
+ */
+class HostDataRegister
+{
+public:
+    HostDataRegister& operator=(const unsigned char& value);
+
+    operator unsigned char(void) const;
+
+private:
+    /**
+     *  \var    _receivedByte
+     *  \brief  The byte shifted in during the last exchange.
+     */
+    unsigned char _receivedByte = 0x00;
+};
+
+/**
+ *  \fn     deliverSpiInterrupts(void)
+ *  \brief  Calls the SPI_STC_vect handler while the interrupt is pending.
+ *
+ *  The handler runs with the I bit of SREG cleared. Nested calls, e.g. from
+ *  a handler that writes SPDR again, return immediately and are picked up by
+ *  the outer loop instead.
+ */
+void deliverSpiInterrupts(void);
+
+#endif //__HOST_REGISTER_HPP__
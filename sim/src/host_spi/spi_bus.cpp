@@ -0,0 +1,29 @@
+/**
+ *  \file   spi_bus.cpp
+ *  \brief  The file contains implementation for the host SpiBus class.
+ */
+
+#include "spi_bus.hpp"
+
+#include <avr/io.h>
+
+void SpiBus::initialize(const uint8_t& mode)
+{
+    SPCR = (1 << SPE) | (1 << MSTR) | ((mode & 0x03) << CPHA);
+}
+
+void SpiBus::sendByte(const uint8_t& byte)
+{
+    SPDR = byte;
+
+    while (!(SPSR & (1 << SPIF)))
+    {
+        ;
+    }
+}
+
+uint8_t SpiBus::recvByte(void)
+{
+    sendByte(0x00);
+    return SPDR;
+}
@@ -0,0 +1,40 @@
+/**
+ *  \file   spi_bus.hpp
+ *  \brief  The file contains declaration for the host SpiBus class.
+ */
+
+#ifndef __HOST_SPI_BUS_HPP__
+#define __HOST_SPI_BUS_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \class  SpiBus
+ *  \brief  The class represents the simulated SPI master of the host.
+ */
+class SpiBus
+{
+public:
+    /**
+     *  \fn         initialize(const uint8_t& mode)
+     *  \brief      Enables the simulated SPI peripheral as master.
+     *  \param[in]  mode passes the SPI mode. It is stored in SPCR only.
+     */
+    static void initialize(const uint8_t& mode = 0x00);
+
+    /**
+     *  \fn         sendByte(const uint8_t& byte)
+     *  \brief      Sends a single byte to the simulated W5500.
+     *  \param[in]  byte passes the byte to send.
+     */
+    static void sendByte(const uint8_t& byte);
+
+    /**
+     *  \fn     recvByte(void)
+     *  \brief  Receives a single byte from the simulated W5500.
+     *  \return The byte shifted in while sending a dummy byte.
+     */
+    static uint8_t recvByte(void);
+};
+
+#endif //__HOST_SPI_BUS_HPP__
@@ -0,0 +1,30 @@
+/**
+ *  \file   spi_device.cpp
+ *  \brief  The file contains implementation for the host SpiDevice class.
+ */
+
+#include "spi_device.hpp"
+
+#include "../chip_model/w5500_simulator.hpp"
+
+SpiDevice::SpiDevice(volatile unsigned char& chipSelectDataDirectionRegister,
+                     volatile unsigned char& chipSelectPort,
+                     const uint8_t& chipSelectPin)
+    : _chipSelectPort(chipSelectPort)
+    , _chipSelectPin(chipSelectPin)
+{
+    chipSelectDataDirectionRegister |= (1 << _chipSelectPin);
+    _chipSelectPort |= (1 << _chipSelectPin);
+}
+
+void SpiDevice::select(void)
+{
+    _chipSelectPort &= ~(1 << _chipSelectPin);
+    W5500Simulator::getInstance().select();
+}
+
+void SpiDevice::deselect(void)
+{
+    W5500Simulator::getInstance().deselect();
+    _chipSelectPort |= (1 << _chipSelectPin);
+}
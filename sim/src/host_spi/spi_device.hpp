@@ -0,0 +1,60 @@
+/**
+ *  \file   spi_device.hpp
+ *  \brief  The file contains declaration for the host SpiDevice class.
+ */
+
+#ifndef __HOST_SPI_DEVICE_HPP__
+#define __HOST_SPI_DEVICE_HPP__
+
+#include <stdint.h>
+
+#include "spi_bus.hpp"
+
+/**
+ *  \class  SpiDevice
+ *  \brief  The class represents a slave on the simulated SPI bus.
+ *
+ *  Selecting and deselecting the device drives the chip select pin and
+ *  starts or ends a frame of the simulated W5500.
+ */
+class SpiDevice
+{
+public:
+    /**
+     *  \fn             SpiDevice()
+     *  \brief          The constructor initializes an instance of type 'SpiDevice'.
+     *  \param[inout]   chipSelectDataDirectionRegister passes the DDR for the SPI CS pin.
+     *  \param[inout]   chipSelectPort passes the PORT for the SPI CS pin.
+     *  \param[in]      chipSelectPin passes the SPI CS pin's index.
+     */
+    SpiDevice(volatile unsigned char& chipSelectDataDirectionRegister,
+              volatile unsigned char& chipSelectPort,
+              const uint8_t& chipSelectPin);
+
+    /**
+     *  \fn     select(void)
+     *  \brief  Pulls the chip select pin low.
+     */
+    void select(void);
+
+    /**
+     *  \fn     deselect(void)
+     *  \brief  Releases the chip select pin.
+     */
+    void deselect(void);
+
+private:
+    /**
+     *  \var    _chipSelectPort
+     *  \brief  The PORT register of the CS pin.
+     */
+    volatile unsigned char& _chipSelectPort;
+
+    /**
+     *  \var    _chipSelectPin
+     *  \brief  The index of the CS pin.
+     */
+    uint8_t _chipSelectPin;
+};
+
+#endif //__HOST_SPI_DEVICE_HPP__
@@ -0,0 +1,150 @@
+/**
+ *  \file   trace_decoder.cpp
+ *  \brief  The file contains the host side decoder of the driver trace.
+ *
+ *  Reads the records drained by Trace::drain() as raw bytes from a file or
+ *  stdin and prints one line per record. The 16 bit timestamps are unwrapped
+ *  into a running time, so consecutive records must be less than one timer
+ *  period apart.
+ *
+ *  Usage: W5500_TraceDecoder [--tick-ns <nanoseconds per timer tick>] [file]
+ */
+
+#include "../../../src/trace/trace_record.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+constexpr uint8_t recordSize = 6;
+
+const char* const eventNames[] = {"INT_NOTIFY", "INT_PASS", "FRAME_START", "FRAME_END",
+                                  "SEND",       "SEND_OK",  "RECV",        "STATE"};
+
+const char* const stateNames[] = {"Closed", "Opened", "Listening", "Connecting",
+                                  "Established", "PeerClosed", "Closing"};
+
+const char* const blockNames[] = {"common", "socket", "tx", "rx"};
+
+/* Parses a record stored little endian as written by the AVR. */
+TraceRecord parseRecord(const unsigned char bytes[recordSize])
+{
+    TraceRecord traceRecord;
+    traceRecord.timestamp = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+    traceRecord.event = bytes[2];
+    traceRecord.socket = bytes[3];
+    traceRecord.argument = static_cast<uint16_t>(bytes[4] | (bytes[5] << 8));
+    return traceRecord;
+}
+
+/* Prints the event specific fields of a record. */
+void printDetails(const TraceRecord& traceRecord)
+{
+    const uint8_t controlByte = traceRecord.socket;
+    const uint8_t block = (controlByte >> 3) & 0x03;
+
+    switch (static_cast<TraceEvent>(traceRecord.event))
+    {
+    case TraceEvent::InterruptNotify:
+        break;
+    case TraceEvent::InterruptPass:
+        printf("sir=0x%02x", traceRecord.argument);
+        break;
+    case TraceEvent::FrameStart:
+        printf("%s%s s%u addr=0x%04x",
+               controlByte & 0x04 ? "write " : "read ",
+               blockNames[block],
+               controlByte >> 5,
+               traceRecord.argument);
+        break;
+    case TraceEvent::FrameEnd:
+        printf("%s%s s%u len=%u",
+               controlByte & 0x04 ? "write " : "read ",
+               blockNames[block],
+               controlByte >> 5,
+               traceRecord.argument);
+        break;
+    case TraceEvent::Send:
+    case TraceEvent::Receive:
+        printf("s%u len=%u", traceRecord.socket, traceRecord.argument);
+        break;
+    case TraceEvent::SendComplete:
+        printf("s%u", traceRecord.socket);
+        break;
+    case TraceEvent::StateChange:
+    {
+        const uint8_t state = traceRecord.argument >> 8;
+        printf("s%u %s sr=0x%02x",
+               traceRecord.socket,
+               state < sizeof(stateNames) / sizeof(stateNames[0]) ? stateNames[state] : "?",
+               traceRecord.argument & 0xff);
+        break;
+    }
+    default:
+        printf("arg=0x%04x", traceRecord.argument);
+        break;
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double tickNanoseconds = 0.0;
+    FILE* input = stdin;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--tick-ns") && i + 1 < argc)
+        {
+            tickNanoseconds = atof(argv[++i]);
+        }
+        else if (!(input = fopen(argv[i], "rb")))
+        {
+            fprintf(stderr, "cannot open %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    unsigned char bytes[recordSize];
+    unsigned long recordIndex = 0;
+    unsigned long long elapsedTicks = 0;
+    uint16_t previousTimestamp = 0;
+
+    while (recordSize == fread(bytes, 1, recordSize, input))
+    {
+        const TraceRecord traceRecord = parseRecord(bytes);
+        const uint16_t deltaTicks = recordIndex ? static_cast<uint16_t>(traceRecord.timestamp - previousTimestamp) : 0;
+
+        elapsedTicks += deltaTicks;
+        previousTimestamp = traceRecord.timestamp;
+
+        if (tickNanoseconds > 0.0)
+        {
+            printf("%6lu %12.3f us %+10.3f us  ",
+                   recordIndex,
+                   elapsedTicks * tickNanoseconds / 1000.0,
+                   deltaTicks * tickNanoseconds / 1000.0);
+        }
+        else
+        {
+            printf("%6lu %10llu +%6u  ", recordIndex, elapsedTicks, deltaTicks);
+        }
+
+        printf("%-11s ",
+               traceRecord.event < sizeof(eventNames) / sizeof(eventNames[0]) ? eventNames[traceRecord.event]
+                                                                                : "UNKNOWN");
+        printDetails(traceRecord);
+        printf("\n");
+
+        recordIndex++;
+    }
+
+    if (input != stdin)
+    {
+        fclose(input);
+    }
+
+    return 0;
+}
@@ -15,6 +15,12 @@
 class Callback
 {
 public:
+    Callback(void)
+        : _instance(nullptr)
+        , _method(nullptr)
+    {
+    }
+
     Callback(CallbackInstance* instance, void (CallbackInstance::*method)(void))
         : _instance(instance)
         , _method(method)
@@ -31,6 +37,9 @@ public:
     void fire(void) { (_instance->*_method)(); }
 
 private:
+    template<typename... Arguments>
+    friend class Delegate;
+
     CallbackInstance* _instance;
     void (CallbackInstance::*_method)(void);
 };
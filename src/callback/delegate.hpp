@@ -0,0 +1,74 @@
+/**
+ *  \file   delegate.hpp
+ *  \brief  The file contains declaration for the delegate class.
+ */
+
+#ifndef __DELEGATE_HPP__
+#define __DELEGATE_HPP__
+
+#include "callback.hpp"
+#include "receive_callback.hpp"
+
+/**
+ *  \class  Delegate
+ *  \brief  The class holds either a plain function or a callback of a callback instance.
+ *  \tparam Arguments the argument types passed to the function or method on fire().
+ *
+ *  Both share one union, the callback's instance pointer tells them apart.
+ *  'Callback' fits a Delegate<> and 'ReceiveCallback' a
+ *  Delegate<AbstractSocket&, RxView&>.
+ */
+template<typename... Arguments>
+class Delegate
+{
+public:
+    Delegate(void)
+        : _instance(nullptr)
+    {
+        _target.function = nullptr;
+    }
+
+    Delegate(void (*function)(Arguments...))
+        : _instance(nullptr)
+    {
+        _target.function = function;
+    }
+
+    template<typename CallbackType>
+    Delegate(const CallbackType& callback)
+        : _instance(callback._instance)
+    {
+        if (_instance)
+        {
+            _target.method = callback._method;
+        }
+        else
+        {
+            _target.function = nullptr;
+        }
+    }
+
+    void fire(Arguments... arguments)
+    {
+        if (_instance)
+        {
+            (_instance->*_target.method)(arguments...);
+        }
+        else if (_target.function)
+        {
+            _target.function(arguments...);
+        }
+    }
+
+private:
+    /* A null instance selects the plain function member of the union. */
+    CallbackInstance* _instance;
+
+    union
+    {
+        void (*function)(Arguments...);
+        void (CallbackInstance::*method)(Arguments...);
+    } _target;
+};
+
+#endif //__DELEGATE_HPP__
@@ -0,0 +1,78 @@
+/**
+ *  \file   delegate_table.hpp
+ *  \brief  The file contains declaration for the DelegateTable class.
+ */
+
+#ifndef __DELEGATE_TABLE_HPP__
+#define __DELEGATE_TABLE_HPP__
+
+#include <stdint.h>
+
+#include "delegate.hpp"
+
+/**
+ *  \def    W5500_SOCKET_DELEGATE_CAPACITY
+ *  \brief  The number of delegates per socket event, adjustable at compile time.
+ */
+#ifndef W5500_SOCKET_DELEGATE_CAPACITY
+#define W5500_SOCKET_DELEGATE_CAPACITY 2
+#endif
+
+/**
+ *  \class  DelegateTable
+ *  \brief  A statically allocated list of delegates.
+ *  \tparam Capacity the maximum number of delegates.
+ *  \tparam Arguments the argument types the delegates get passed on fire().
+ *
+ *  The table never touches the heap. Adding to a full table fails instead
+ *  of growing it, and firing all entries takes a bounded time.
+ */
+template<uint8_t Capacity, typename... Arguments>
+class DelegateTable
+{
+public:
+    typedef Delegate<Arguments...> Entry;
+
+    /**
+     *  \fn         append(const Entry& entry)
+     *  \brief      Adds a delegate to the table.
+     *  \param[in]  entry passes the delegate to add.
+     *  \return     Boolean indicating whether the table had room left.
+     */
+    bool append(const Entry& entry)
+    {
+        if (Capacity == _count)
+        {
+            return false;
+        }
+
+        _entries[_count++] = entry;
+        return true;
+    }
+
+    /**
+     *  \fn     isEmpty(void) const
+     *  \brief  Checks whether no delegate was added.
+     *  \return Boolean indicating an empty table.
+     */
+    bool isEmpty(void) const { return 0 == _count; }
+
+    /**
+     *  \fn         fire(Arguments... arguments)
+     *  \brief      Fires all delegates in the order they were added.
+     *  \param[in]  arguments passes the arguments forwarded to every delegate.
+     */
+    void fire(Arguments... arguments)
+    {
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            _entries[i].fire(arguments...);
+        }
+    }
+
+private:
+    Entry _entries[Capacity];
+    uint8_t _count = 0;
+};
+
+#endif //__DELEGATE_TABLE_HPP__
@@ -0,0 +1,53 @@
+/**
+ *  \file   receive_callback.hpp
+ *  \brief  The file contains declaration for the receive callback class.
+ */
+
+#ifndef __RECEIVE_CALLBACK_HPP__
+#define __RECEIVE_CALLBACK_HPP__
+
+#include "callback_instance.hpp"
+
+class AbstractSocket;
+class RxView;
+
+/**
+ *  \class  ReceiveCallback
+ *  \brief  The class represents a receive callback of a callback instance.
+ *
+ *  In contrast to 'Callback' the method gets the socket and a view on the
+ *  received data passed, so it doesn't need to query the socket again.
+ */
+class ReceiveCallback
+{
+public:
+    ReceiveCallback(void)
+        : _instance(nullptr)
+        , _method(nullptr)
+    {
+    }
+
+    ReceiveCallback(CallbackInstance* instance, void (CallbackInstance::*method)(AbstractSocket&, RxView&))
+        : _instance(instance)
+        , _method(method)
+    {
+    }
+
+    template<typename DerivedInstance>
+    ReceiveCallback(DerivedInstance* instance, void (DerivedInstance::*method)(AbstractSocket&, RxView&))
+        : _instance(static_cast<CallbackInstance*>(instance))
+        , _method(static_cast<void (CallbackInstance::*)(AbstractSocket&, RxView&)>(method))
+    {
+    }
+
+    void fire(AbstractSocket& socket, RxView& receivedData) { (_instance->*_method)(socket, receivedData); }
+
+private:
+    template<typename... Arguments>
+    friend class Delegate;
+
+    CallbackInstance* _instance;
+    void (CallbackInstance::*_method)(AbstractSocket&, RxView&);
+};
+
+#endif //__RECEIVE_CALLBACK_HPP__
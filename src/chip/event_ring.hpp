@@ -0,0 +1,101 @@
+/**
+ *  \file   event_ring.hpp
+ *  \brief  The file contains declaration for the EventRing class.
+ */
+
+#ifndef __EVENT_RING_HPP__
+#define __EVENT_RING_HPP__
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <stdint.h>
+
+/**
+ *  \enum   ChipEvent
+ *  \brief  The events recorded by interrupt handlers for the main loop.
+ */
+enum class ChipEvent : uint8_t
+{
+    Interrupt = 0x01,
+    Tick = 0x02
+};
+
+/**
+ *  \class  EventRing
+ *  \brief  A ring of events pushed by interrupt handlers and popped by the main loop.
+ *  \tparam Event the trivially copyable event type.
+ *  \tparam Capacity the number of slots, a power of two up to 128.
+ *
+ *  Several interrupt handlers may push, e.g. W5500::notifyInterrupt() from
+ *  the INTn handler and W5500::notifyTick() from a timer, and a handler
+ *  re-enabling interrupts may be preempted by another one. push() therefore
+ *  claims its slot with interrupts disabled. The single consumer calling
+ *  pop() only writes the tail, which is a single byte, so it needs no lock
+ *  on an 8 bit AVR. The ring holds up to Capacity - 1 events.
+ */
+template<typename Event, uint8_t Capacity>
+class EventRing
+{
+    static_assert(Capacity >= 2 && Capacity <= 128 && 0 == (Capacity & (Capacity - 1)),
+                  "Capacity must be a power of two between 2 and 128.");
+
+public:
+    /**
+     *  \fn         push(const Event& event)
+     *  \brief      Appends an event, safe to call from any interrupt handler.
+     *  \param[in]  event passes the event to append.
+     *  \return     Boolean indicating whether the ring had room for the event.
+     */
+    bool push(const Event& event)
+    {
+        const uint8_t statusRegister = SREG;
+        cli();
+
+        const uint8_t head = _head;
+        const uint8_t nextHead = (head + 1) & (Capacity - 1);
+        const bool hasRoom = nextHead != _tail;
+
+        if (hasRoom)
+        {
+            _events[head] = event;
+            _head = nextHead;
+        }
+
+        SREG = statusRegister;
+        return hasRoom;
+    }
+
+    /**
+     *  \fn         pop(Event& event)
+     *  \brief      Removes the oldest event, called by the consumer only.
+     *  \param[out] event passes the variable to store the event in.
+     *  \return     Boolean indicating whether an event was available.
+     */
+    bool pop(Event& event)
+    {
+        const uint8_t tail = _tail;
+
+        if (tail == _head)
+        {
+            return false;
+        }
+
+        event = _events[tail];
+        _tail = (tail + 1) & (Capacity - 1);
+        return true;
+    }
+
+    /**
+     *  \fn     isEmpty(void) const
+     *  \brief  Checks whether no event is queued.
+     *  \return Boolean indicating an empty ring.
+     */
+    bool isEmpty(void) const { return _head == _tail; }
+
+private:
+    volatile Event _events[Capacity] = {};
+    volatile uint8_t _head = 0;
+    volatile uint8_t _tail = 0;
+};
+
+#endif //__EVENT_RING_HPP__
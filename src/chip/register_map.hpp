@@ -0,0 +1,179 @@
+/**
+ *  \file   register_map.hpp
+ *  \brief  The file contains the compile-time register map of the W5500.
+ *
+ *  Every register is a type carrying its block, offset and width. Accessors
+ *  taking such a type as template argument fold the address, the control
+ *  byte and the length into constants, so no register address has to be
+ *  stored in SRAM or recomputed at runtime.
+ */
+
+#ifndef __REGISTER_MAP_HPP__
+#define __REGISTER_MAP_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \enum   RegisterBlock
+ *  \brief  The block select bits of the W5500 control phase.
+ *
+ *  The socket blocks are relative to a socket. Their BSB value is completed
+ *  by the socket index in the three most significant bits of the control
+ *  byte.
+ */
+enum class RegisterBlock : uint8_t
+{
+    Common = 0x00,
+    Socket = 0x01,
+    SocketTXBuffer = 0x02,
+    SocketRXBuffer = 0x03
+};
+
+/**
+ *  \fn         getControlByte(const RegisterBlock& block, const bool& isWrite)
+ *  \brief      Returns the control byte for an access in variable length data mode.
+ *  \param[in]  block passes the register block to access.
+ *  \param[in]  isWrite passes whether the RWB bit is set.
+ *  \return     The control byte without socket index.
+ */
+constexpr unsigned char getControlByte(const RegisterBlock& block, const bool& isWrite)
+{
+    return static_cast<unsigned char>((static_cast<uint8_t>(block) << 3) | (isWrite ? 0x04 : 0x00));
+}
+
+/**
+ *  \fn         getSocketBlockBits(const uint8_t& socketIndex)
+ *  \brief      Returns the control byte bits selecting the socket's blocks.
+ *  \param[in]  socketIndex passes the hardware index of the socket.
+ *  \return     The socket index shifted into bits 7 to 5.
+ */
+constexpr unsigned char getSocketBlockBits(const uint8_t& socketIndex)
+{
+    return static_cast<unsigned char>(socketIndex << 5);
+}
+
+/**
+ *  \struct Register
+ *  \brief  Describes a W5500 register at compile time.
+ *  \tparam Block the register block containing the register.
+ *  \tparam Address the offset of the register within its block.
+ *  \tparam Width the number of bytes of the register.
+ */
+template<RegisterBlock Block, uint16_t Address, uint8_t Width>
+struct Register
+{
+    static constexpr RegisterBlock block = Block;
+    static constexpr uint16_t address = Address;
+    static constexpr uint8_t width = Width;
+    static constexpr unsigned char readControlByte = getControlByte(Block, false);
+    static constexpr unsigned char writeControlByte = getControlByte(Block, true);
+};
+
+/**
+ *  \namespace  CommonRegister
+ *  \brief      The registers of the common register block.
+ */
+namespace CommonRegister
+{
+using Mode = Register<RegisterBlock::Common, 0x0000, 1>;
+using GatewayAddress = Register<RegisterBlock::Common, 0x0001, 4>;
+using SubnetMask = Register<RegisterBlock::Common, 0x0005, 4>;
+using SourceHardwareAddress = Register<RegisterBlock::Common, 0x0009, 6>;
+using SourceIPAddress = Register<RegisterBlock::Common, 0x000f, 4>;
+using InterruptLowLevelTimer = Register<RegisterBlock::Common, 0x0013, 2>;
+using Interrupt = Register<RegisterBlock::Common, 0x0015, 1>;
+using InterruptMask = Register<RegisterBlock::Common, 0x0016, 1>;
+using SocketInterrupt = Register<RegisterBlock::Common, 0x0017, 1>;
+using SocketInterruptMask = Register<RegisterBlock::Common, 0x0018, 1>;
+using RetryTime = Register<RegisterBlock::Common, 0x0019, 2>;
+using RetryCount = Register<RegisterBlock::Common, 0x001b, 1>;
+using PhyConfiguration = Register<RegisterBlock::Common, 0x002e, 1>;
+using ChipVersion = Register<RegisterBlock::Common, 0x0039, 1>;
+
+/* GAR, SUBR, SHAR and SIPR, written and verified in a single frame. */
+using NetworkConfiguration = Register<RegisterBlock::Common, 0x0001, 18>;
+} // namespace CommonRegister
+
+/**
+ *  \namespace  SocketRegister
+ *  \brief      The registers of a socket register block.
+ */
+namespace SocketRegister
+{
+using Mode = Register<RegisterBlock::Socket, 0x0000, 1>;
+using Command = Register<RegisterBlock::Socket, 0x0001, 1>;
+using Interrupt = Register<RegisterBlock::Socket, 0x0002, 1>;
+using Status = Register<RegisterBlock::Socket, 0x0003, 1>;
+using SourcePort = Register<RegisterBlock::Socket, 0x0004, 2>;
+using DestinationHardwareAddress = Register<RegisterBlock::Socket, 0x0006, 6>;
+using DestinationIPAddress = Register<RegisterBlock::Socket, 0x000c, 4>;
+using DestinationPort = Register<RegisterBlock::Socket, 0x0010, 2>;
+using MaximumSegmentSize = Register<RegisterBlock::Socket, 0x0012, 2>;
+using RXBufferSize = Register<RegisterBlock::Socket, 0x001e, 1>;
+using TXBufferSize = Register<RegisterBlock::Socket, 0x001f, 1>;
+using TXFreeSize = Register<RegisterBlock::Socket, 0x0020, 2>;
+using TXReadPointer = Register<RegisterBlock::Socket, 0x0022, 2>;
+using TXWritePointer = Register<RegisterBlock::Socket, 0x0024, 2>;
+using RXReceivedSize = Register<RegisterBlock::Socket, 0x0026, 2>;
+using RXReadPointer = Register<RegisterBlock::Socket, 0x0028, 2>;
+using RXWritePointer = Register<RegisterBlock::Socket, 0x002a, 2>;
+using InterruptMask = Register<RegisterBlock::Socket, 0x002c, 1>;
+using KeepAliveTimer = Register<RegisterBlock::Socket, 0x002f, 1>;
+
+/* Ranges spanning several contiguous registers, read in a single frame. */
+using InterruptAndStatus = Register<RegisterBlock::Socket, 0x0002, 2>;
+using BufferState = Register<RegisterBlock::Socket, 0x0020, 12>;
+using BufferSizes = Register<RegisterBlock::Socket, 0x001e, 2>;
+} // namespace SocketRegister
+
+/**
+ *  \namespace  SocketCommand
+ *  \brief      The values written to Sn_CR.
+ */
+namespace SocketCommand
+{
+constexpr unsigned char Open = 0x01;
+constexpr unsigned char Listen = 0x02;
+constexpr unsigned char Connect = 0x04;
+constexpr unsigned char Disconnect = 0x08;
+constexpr unsigned char Close = 0x10;
+constexpr unsigned char Send = 0x20;
+constexpr unsigned char SendKeepAlive = 0x22;
+constexpr unsigned char Receive = 0x40;
+} // namespace SocketCommand
+
+/**
+ *  \namespace  SocketStatus
+ *  \brief      The values read from Sn_SR.
+ */
+namespace SocketStatus
+{
+constexpr unsigned char Closed = 0x00;
+constexpr unsigned char Initialized = 0x13;
+constexpr unsigned char Listening = 0x14;
+constexpr unsigned char SynSent = 0x15;
+constexpr unsigned char SynReceived = 0x16;
+constexpr unsigned char Established = 0x17;
+constexpr unsigned char FinWait = 0x18;
+constexpr unsigned char Closing = 0x1a;
+constexpr unsigned char TimeWait = 0x1b;
+constexpr unsigned char CloseWait = 0x1c;
+constexpr unsigned char LastAck = 0x1d;
+constexpr unsigned char Udp = 0x22;
+constexpr unsigned char MacRaw = 0x42;
+} // namespace SocketStatus
+
+/**
+ *  \namespace  SocketInterrupt
+ *  \brief      The bits of Sn_IR and Sn_IMR.
+ */
+namespace SocketInterrupt
+{
+constexpr unsigned char Connected = 0x01;
+constexpr unsigned char Disconnected = 0x02;
+constexpr unsigned char Received = 0x04;
+constexpr unsigned char TimedOut = 0x08;
+constexpr unsigned char SendOk = 0x10;
+} // namespace SocketInterrupt
+
+#endif //__REGISTER_MAP_HPP__
@@ -7,8 +7,46 @@
 
 #include "../socket/tcp_socket.hpp"
 #include "../socket/udp_socket.hpp"
+#include "../trace/trace.hpp"
+#include <avr/interrupt.h>
 #include <avr/io.h>
 
+#if defined(W5500_SPI_ISR) || defined(W5500_SPI_ISR_FORWARDED)
+#define W5500_ASYNC_TRANSFER
+#endif
+
+W5500* W5500::_activeTransferChip = nullptr;
+
+namespace
+{
+/* Counts the events flagged in a Sn_IR value. */
+uint8_t countInterruptFlags(unsigned char interruptFlags)
+{
+    uint8_t flagCount = 0;
+
+    for (; interruptFlags; interruptFlags &= interruptFlags - 1)
+    {
+        flagCount++;
+    }
+
+    return flagCount;
+}
+
+/* Adds the events flagged in a Sn_IR value to a counter saturating at 0xff. */
+void addInterruptFlags(uint8_t& eventCount, const unsigned char& interruptFlags)
+{
+    const uint8_t flagCount = countInterruptFlags(interruptFlags);
+    eventCount = eventCount > 0xff - flagCount ? 0xff : eventCount + flagCount;
+}
+} // namespace
+
+#ifdef W5500_SPI_ISR
+ISR(SPI_STC_vect)
+{
+    W5500::handleTransferInterrupt();
+}
+#endif
+
 W5500::W5500(const MacAddress& macAddress,
              const HostAddress& gatewayIPv4Address,
              const SubnetMask& subnetMask,
@@ -19,10 +57,11 @@ W5500::W5500(const MacAddress& macAddress,
     : SpiDevice(chipSelectDataDirectionRegister, chipSelectPort, chipSelectPin)
 {
     SpiBus::initialize();
+    holdFixedLengthSelect();
 
     if (verify())
     {
-        initRegister(macAddress, gatewayIPv4Address, subnetMask, sourceIPv4Address);
+        _isConfigured = initRegister(macAddress, gatewayIPv4Address, subnetMask, sourceIPv4Address);
     }
 }
 
@@ -36,29 +75,35 @@ W5500::W5500(const char* macAddress,
     : SpiDevice(chipSelectDataDirectionRegister, chipSelectPort, chipSelectPin)
 {
     SpiBus::initialize(0x00);
+    holdFixedLengthSelect();
 
     if (verify())
     {
-        initRegister(MacAddress(macAddress),
-                     HostAddress(gatewayIPv4Address),
-                     SubnetMask(subnetMask),
-                     HostAddress(sourceIPv4Address));
+        _isConfigured = initRegister(MacAddress(macAddress),
+                                     HostAddress(gatewayIPv4Address),
+                                     SubnetMask(subnetMask),
+                                     HostAddress(sourceIPv4Address));
     }
 }
 
 bool W5500::verify(void)
 {
     unsigned char versionNumber;
-    readRegister(_chipVersionRegisterAddress, 0x00, &versionNumber, 1);
+    readCommonRegister<CommonRegister::ChipVersion>(&versionNumber);
     return 0x04 == versionNumber;
 }
 
+bool W5500::isConfigured(void) const
+{
+    return _isConfigured;
+}
+
 bool W5500::setMACAddress(const MacAddress& macAddress)
 {
-    writeRegister(_macAddrRegisterAddress, 0x04, macAddress.toArray(), 6);
+    writeCommonRegister<CommonRegister::SourceHardwareAddress>(macAddress.toArray());
 
     unsigned char addressToValidate[6];
-    readRegister(_macAddrRegisterAddress, 0x00, addressToValidate, 6);
+    readCommonRegister<CommonRegister::SourceHardwareAddress>(addressToValidate);
 
     bool isSame = true;
     for (uint8_t i = 0; i < 6; i++)
@@ -70,10 +115,10 @@ bool W5500::setMACAddress(const MacAddress& macAddress)
 
 bool W5500::setGatewayAddress(const HostAddress& gatewayAddress)
 {
-    writeRegister(_gatewayAddrRegisterAddress, 0x04, gatewayAddress.toArray(), 4);
+    writeCommonRegister<CommonRegister::GatewayAddress>(gatewayAddress.toArray());
 
     unsigned char addressToValidate[4];
-    readRegister(_gatewayAddrRegisterAddress, 0x00, addressToValidate, 4);
+    readCommonRegister<CommonRegister::GatewayAddress>(addressToValidate);
 
     bool isSame = true;
     for (uint8_t i = 0; i < 4; i++)
@@ -85,10 +130,10 @@ bool W5500::setGatewayAddress(const HostAddress& gatewayAddress)
 
 bool W5500::setSourceAddress(const HostAddress& sourceAddress)
 {
-    writeRegister(_sourceAddrRegisterAddress, 0x04, sourceAddress.toArray(), 4);
+    writeCommonRegister<CommonRegister::SourceIPAddress>(sourceAddress.toArray());
 
     unsigned char addressToValidate[4];
-    readRegister(_sourceAddrRegisterAddress, 0x00, addressToValidate, 4);
+    readCommonRegister<CommonRegister::SourceIPAddress>(addressToValidate);
 
     bool isSame = true;
     for (uint8_t i = 0; i < 4; i++)
@@ -100,10 +145,10 @@ bool W5500::setSourceAddress(const HostAddress& sourceAddress)
 
 bool W5500::setSubnetMask(const SubnetMask& subnetMask)
 {
-    writeRegister(_subnetMaskRegisterAddress, 0x04, subnetMask.toArray(), 4);
+    writeCommonRegister<CommonRegister::SubnetMask>(subnetMask.toArray());
 
     unsigned char addressToValidate[4];
-    readRegister(_subnetMaskRegisterAddress, 0x00, addressToValidate, 4);
+    readCommonRegister<CommonRegister::SubnetMask>(addressToValidate);
 
     bool isSame = true;
     for (uint8_t i = 0; i < 4; i++)
@@ -113,76 +158,225 @@ bool W5500::setSubnetMask(const SubnetMask& subnetMask)
     return isSame;
 }
 
-uint8_t W5500::registerSocket(AbstractSocket* socket)
+uint8_t W5500::registerSocket(AbstractSocket* socket, const uint8_t& txBufferSize, const uint8_t& rxBufferSize)
 {
-    uint8_t targetIndex = 0x09;
+    if (!isValidBufferSize(txBufferSize) || !isValidBufferSize(rxBufferSize))
+    {
+        return invalidSocketIndex;
+    }
+
+    uint8_t targetIndex = invalidSocketIndex;
+    uint8_t allocatedTXSize = txBufferSize;
+    uint8_t allocatedRXSize = rxBufferSize;
+    uint8_t unusedTXSize = 0;
+    uint8_t unusedRXSize = 0;
 
     for (uint8_t i = 0; i < 8; i++)
     {
-        if (!(_occupiedSocketMask & (1 << i)))
+        if (_occupiedSocketMask & (1 << i))
+        {
+            allocatedTXSize += _txBufferSizes[i];
+            allocatedRXSize += _rxBufferSizes[i];
+        }
+        else if (invalidSocketIndex == targetIndex)
         {
             targetIndex = i;
-            break;
+        }
+        else
+        {
+            unusedTXSize += _txBufferSizes[i];
+            unusedRXSize += _rxBufferSizes[i];
+        }
+    }
+
+    if (invalidSocketIndex == targetIndex || allocatedTXSize > _totalBufferSize
+        || allocatedRXSize > _totalBufferSize)
+    {
+        return invalidSocketIndex;
+    }
+
+    const bool releaseTXBuffers = allocatedTXSize + unusedTXSize > _totalBufferSize;
+    const bool releaseRXBuffers = allocatedRXSize + unusedRXSize > _totalBufferSize;
+
+    if (releaseTXBuffers || releaseRXBuffers)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            if (i != targetIndex && !(_occupiedSocketMask & (1 << i)))
+            {
+                setSocketBufferSizes(i,
+                                     releaseTXBuffers ? 0 : _txBufferSizes[i],
+                                     releaseRXBuffers ? 0 : _rxBufferSizes[i]);
+            }
         }
     }
 
+    setSocketBufferSizes(targetIndex, txBufferSize, rxBufferSize);
+
     _socketList[targetIndex] = socket;
 
     _occupiedSocketMask |= (1 << targetIndex);
+    enableSocketInterrupts(_occupiedSocketMask);
+
     return targetIndex;
 }
 
-void W5500::initRegister(const MacAddress& macAddress,
+uint16_t W5500::getTXBufferSize(const uint8_t& index) const
+{
+    return static_cast<uint16_t>(_txBufferSizes[index]) << 10;
+}
+
+bool W5500::isValidBufferSize(const uint8_t& size)
+{
+    return size <= _totalBufferSize && 0 == (size & (size - 1));
+}
+
+void W5500::setSocketBufferSizes(const uint8_t& index, const uint8_t& txBufferSize, const uint8_t& rxBufferSize)
+{
+    if (txBufferSize == _txBufferSizes[index] && rxBufferSize == _rxBufferSizes[index])
+    {
+        return;
+    }
+
+    const unsigned char bufferSizes[SocketRegister::BufferSizes::width] = {rxBufferSize, txBufferSize};
+    writeRegister(SocketRegister::BufferSizes::address,
+                  SocketRegister::BufferSizes::writeControlByte | getSocketBlockBits(index),
+                  bufferSizes,
+                  SocketRegister::BufferSizes::width);
+
+    _txBufferSizes[index] = txBufferSize;
+    _rxBufferSizes[index] = rxBufferSize;
+}
+
+bool W5500::initRegister(const MacAddress& macAddress,
                          const HostAddress& gatewayAddress,
                          const SubnetMask& subnetMask,
                          const HostAddress& sourceAddress)
 {
-    resetRegister(_modeRegisterAddress);
-    resetRegister(_phyConfigRegisterAddress);
-    setMACAddress(macAddress);
-    setGatewayAddress(gatewayAddress);
-    setSubnetMask(subnetMask);
-    setSourceAddress(sourceAddress);
-    setInterruptLowLevelTimer(0xffff);
-    enableSocketInterrupts();
+    resetChip();
+
+    unsigned char networkConfiguration[CommonRegister::NetworkConfiguration::width];
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        networkConfiguration[i] = gatewayAddress.toArray()[i];
+        networkConfiguration[4 + i] = subnetMask.toArray()[i];
+        networkConfiguration[14 + i] = sourceAddress.toArray()[i];
+    }
+
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        networkConfiguration[8 + i] = macAddress.toArray()[i];
+    }
+
+    writeCommonRegister<CommonRegister::NetworkConfiguration>(networkConfiguration);
+    setInterruptLowLevelTimer(_interruptLevel);
+    enableSocketInterrupts(_occupiedSocketMask);
+
+#ifdef W5500_FAST_BOOT
+    return true;
+#else
+    unsigned char configurationToValidate[CommonRegister::NetworkConfiguration::width];
+    readCommonRegister<CommonRegister::NetworkConfiguration>(configurationToValidate);
+
+    bool isSame = true;
+    for (uint8_t i = 0; i < CommonRegister::NetworkConfiguration::width; i++)
+    {
+        isSame = isSame && networkConfiguration[i] == configurationToValidate[i];
+    }
+
+    return isSame;
+#endif
+}
+
+void W5500::resetChip(void)
+{
+    const unsigned char modeReset = 0x80;
+    writeCommonRegister<CommonRegister::Mode>(&modeReset);
+
+    /* Pulses RST low and high again, the operation mode bits are kept. */
+    unsigned char phyConfiguration;
+    readCommonRegister<CommonRegister::PhyConfiguration>(&phyConfiguration);
+    phyConfiguration &= ~0x80;
+    writeCommonRegister<CommonRegister::PhyConfiguration>(&phyConfiguration);
+    phyConfiguration |= 0x80;
+    writeCommonRegister<CommonRegister::PhyConfiguration>(&phyConfiguration);
 }
 
 void W5500::setInterruptLowLevelTimer(const uint16_t& value)
 {
-    const unsigned char valueInBytes[2] = {(value >> 8) & 0xff, value & 0xff};
-    constexpr uint16_t INTLEVELREgisterAddresss = 0x0013;
-    writeRegister(INTLEVELREgisterAddresss, 0x04, valueInBytes, 2);
+    const unsigned char valueInBytes[2] = {static_cast<unsigned char>((value >> 8) & 0xff),
+                                           static_cast<unsigned char>(value & 0xff)};
+    writeCommonRegister<CommonRegister::InterruptLowLevelTimer>(valueInBytes);
+
+    _interruptLevel = value;
 }
 
-void W5500::unsubscribeSocket(const uint8_t& index)
+void W5500::setInterruptCoalescing(const uint16_t& minimumLevel,
+                                   const uint16_t& maximumLevel,
+                                   const uint8_t& burstEventCount)
 {
-    _occupiedSocketMask &= ~(1 << index);
+    _minimumInterruptLevel = minimumLevel;
+    _maximumInterruptLevel = maximumLevel < minimumLevel ? minimumLevel : maximumLevel;
+    _burstEventCount = burstEventCount;
+
+    if (_interruptLevel != _minimumInterruptLevel)
+    {
+        setInterruptLowLevelTimer(_minimumInterruptLevel);
+    }
 }
 
-void W5500::resetRegister(const uint16_t& registerAddress)
+uint16_t W5500::getInterruptLevel(void) const
 {
-    unsigned char tempRegister;
+    return _interruptLevel;
+}
+
+void W5500::adaptInterruptLevel(const uint8_t& eventCount)
+{
+    uint16_t interruptLevel = _interruptLevel;
+
+    if (eventCount >= _burstEventCount)
+    {
+        const uint32_t widenedLevel = (static_cast<uint32_t>(interruptLevel) << 1) | 0x01;
+        interruptLevel = widenedLevel > _maximumInterruptLevel ? _maximumInterruptLevel
+                                                               : static_cast<uint16_t>(widenedLevel);
+    }
+    else if (eventCount <= 1)
+    {
+        interruptLevel >>= 1;
+        interruptLevel = interruptLevel < _minimumInterruptLevel ? _minimumInterruptLevel : interruptLevel;
+    }
 
-    readRegister(registerAddress, 0x00, &tempRegister, 1);
-    tempRegister &= ~(1 << 7);
-    writeRegister(registerAddress, 0x04, &tempRegister, 1);
+    if (interruptLevel != _interruptLevel)
+    {
+        setInterruptLowLevelTimer(interruptLevel);
+    }
+}
 
-    readRegister(registerAddress, 0x00, &tempRegister, 1);
-    tempRegister |= (1 << 7);
-    writeRegister(registerAddress, 0x04, &tempRegister, 1);
+void W5500::unsubscribeSocket(const uint8_t& index)
+{
+    _occupiedSocketMask &= ~(1 << index);
+    _socketList[index] = nullptr;
+    enableSocketInterrupts(_occupiedSocketMask);
 }
 
 void W5500::enableSocketInterrupts(const unsigned char& interruptMask)
 {
-    writeRegister(_socketInterruptMaskRegister, 0x04, &interruptMask, 1);
+    writeCommonRegister<CommonRegister::SocketInterruptMask>(&interruptMask);
 }
 
 void W5500::handleInterrupt(void)
 {
-    unsigned char interruptIndicator;
-    readRegister(_socketInterruptRegister, 0x00, &interruptIndicator, 1);
+    uint8_t eventCount = 0;
+    dispatchSocketInterrupts(eventCount);
+    adaptInterruptLevel(eventCount);
+}
 
-    PORTA = ~interruptIndicator;
+unsigned char W5500::dispatchSocketInterrupts(uint8_t& eventCount)
+{
+    unsigned char interruptIndicator;
+    readCommonRegister<CommonRegister::SocketInterrupt>(&interruptIndicator);
+    W5500_TRACE_EVENT(TraceEvent::InterruptPass, 0, interruptIndicator);
 
     for (uint8_t i = 0; i < 8; i++)
     {
@@ -190,15 +384,290 @@ void W5500::handleInterrupt(void)
 
         if (currentSocket && interruptIndicator & (1 << i))
         {
-            currentSocket->eventOccured();
+            /* Callbacks may overwrite _interruptFlags, so count the flags that were read. */
+            addInterruptFlags(eventCount, currentSocket->eventOccured());
+        }
+    }
+
+    return interruptIndicator;
+}
+
+void W5500::notifyInterrupt(void)
+{
+    W5500_TRACE_EVENT(TraceEvent::InterruptNotify, 0, 0);
+
+    if (!_eventRing.push(ChipEvent::Interrupt))
+    {
+        _isInterruptMissed = true;
+    }
+}
+
+void W5500::notifyTick(void)
+{
+    _eventRing.push(ChipEvent::Tick);
+}
+
+bool W5500::poll(void)
+{
+    const uint8_t statusRegister = SREG;
+    cli();
+
+    bool isInterruptPending = _isInterruptMissed;
+    _isInterruptMissed = false;
+
+    SREG = statusRegister;
+
+    bool isEventProcessed = isInterruptPending;
+    uint8_t tickCount = 0;
+
+    ChipEvent event;
+    while (_eventRing.pop(event))
+    {
+        isEventProcessed = true;
+
+        if (ChipEvent::Interrupt == event)
+        {
+            isInterruptPending = true;
+        }
+        else if (ChipEvent::Tick == event && tickCount < 0xff)
+        {
+            tickCount++;
+        }
+    }
+
+    if (isInterruptPending)
+    {
+        uint8_t passCount = 0;
+        uint8_t eventCount = 0;
+
+        while (dispatchSocketInterrupts(eventCount))
+        {
+            if (++passCount == _maximumInterruptPasses)
+            {
+                _isInterruptMissed = true;
+                break;
+            }
+        }
+
+        adaptInterruptLevel(eventCount);
+    }
+
+    for (; tickCount; tickCount--)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            if (_socketList[i])
+            {
+                _socketList[i]->tick();
+            }
         }
     }
+
+    return isEventProcessed;
+}
+
+uint8_t W5500::pollReadiness(uint8_t readiness[8])
+{
+    unsigned char interruptIndicator;
+    readCommonRegister<CommonRegister::SocketInterrupt>(&interruptIndicator);
+    W5500_TRACE_EVENT(TraceEvent::InterruptPass, 0, interruptIndicator);
+
+    uint8_t readyMask = 0x00;
+    uint8_t eventCount = 0;
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        AbstractSocket* currentSocket = _socketList[i];
+        readiness[i] = 0x00;
+
+        if (!currentSocket)
+        {
+            continue;
+        }
+
+        if (interruptIndicator & (1 << i))
+        {
+            unsigned char interruptFlags;
+            readiness[i] = currentSocket->takeReadiness(interruptFlags);
+            addInterruptFlags(eventCount, interruptFlags);
+        }
+
+        readiness[i] |= currentSocket->getReadinessLevel();
+
+        if (readiness[i])
+        {
+            readyMask |= (1 << i);
+        }
+    }
+
+    if (interruptIndicator)
+    {
+        adaptInterruptLevel(eventCount);
+    }
+
+    return readyMask;
+}
+
+bool W5500::isTransferPending(void) const
+{
+    return 0 != _transferCount;
+}
+
+void W5500::handleTransferInterrupt(void)
+{
+    if (_activeTransferChip)
+    {
+        _activeTransferChip->continueTransfer();
+    }
+}
+
+bool W5500::writeRegisterAsync(const uint16_t& addressWord,
+                               const unsigned char& controlByte,
+                               const unsigned char* dataByteArray,
+                               const uint16_t& dataByteCount,
+                               void (*onComplete)(void))
+{
+#ifndef W5500_ASYNC_TRANSFER
+    /* Without an ISR driving the queue, the caller writes the frame blocking. */
+    return false;
+#else
+    if (0 == dataByteCount)
+    {
+        return false;
+    }
+
+    const TransferFrame frame = {addressWord, controlByte, dataByteArray, dataByteCount, onComplete};
+    return enqueueTransfer(frame);
+#endif
+}
+
+bool W5500::enqueueTransfer(const TransferFrame& frame)
+{
+    const uint8_t statusRegister = SREG;
+    cli();
+
+    const bool hasFreeSlot = _transferCount < _transferQueueSize;
+
+    if (hasFreeSlot)
+    {
+        _transferQueue[(_transferHead + _transferCount) % _transferQueueSize] = frame;
+        _transferCount++;
+
+        if (1 == _transferCount)
+        {
+            startTransfer();
+        }
+    }
+
+    SREG = statusRegister;
+    return hasFreeSlot;
+}
+
+void W5500::startTransfer(void)
+{
+    _activeTransferChip = this;
+    _transferOffset = 0;
+
+    W5500_TRACE_EVENT(TraceEvent::FrameStart,
+                      _transferQueue[_transferHead].controlByte,
+                      _transferQueue[_transferHead].addressWord);
+
+    startTransferChunk();
+    SPCR |= (1 << SPIE);
+}
+
+void W5500::startTransferChunk(void)
+{
+    const TransferFrame& frame = _transferQueue[_transferHead];
+
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+    _chunkLength = getFixedLengthChunk(frame.dataByteCount - _transferOffset);
+#else
+    _chunkLength = frame.dataByteCount;
+    SpiDevice::select();
+#endif
+
+    _chunkPosition = 0;
+    SPDR = static_cast<unsigned char>((frame.addressWord + _transferOffset) >> 8);
+}
+
+void W5500::continueTransfer(void)
+{
+    const TransferFrame& frame = _transferQueue[_transferHead];
+
+    _chunkPosition++;
+
+    if (_chunkPosition < _chunkLength + 3)
+    {
+        unsigned char nextByte = 0x00;
+
+        if (1 == _chunkPosition)
+        {
+            nextByte = static_cast<unsigned char>((frame.addressWord + _transferOffset) & 0xff);
+        }
+        else if (2 == _chunkPosition)
+        {
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+            nextByte = frame.controlByte | getOperationMode(_chunkLength);
+#else
+            nextByte = frame.controlByte;
+#endif
+        }
+        else
+        {
+            nextByte = frame.txData[_transferOffset + _chunkPosition - 3];
+        }
+
+        SPDR = nextByte;
+        return;
+    }
+
+    _transferOffset += _chunkLength;
+
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+    if (_transferOffset < frame.dataByteCount)
+    {
+        startTransferChunk();
+        return;
+    }
+#else
+    SpiDevice::deselect();
+#endif
+
+    W5500_TRACE_EVENT(TraceEvent::FrameEnd, frame.controlByte, frame.dataByteCount);
+
+    void (*onComplete)(void) = frame.onComplete;
+
+    _transferHead = (_transferHead + 1) % _transferQueueSize;
+    _transferCount--;
+
+    if (_transferCount)
+    {
+        startTransfer();
+    }
+    else
+    {
+        SPCR &= ~(1 << SPIE);
+    }
+
+    if (onComplete)
+    {
+        onComplete();
+    }
+}
+
+void W5500::waitForTransferQueue(void)
+{
+    while (_transferCount)
+    {
+        ;
+    }
 }
 
 bool W5500::resetSocketInterrupts(void)
 {
     unsigned char interruptIndicator;
-    readRegister(_socketInterruptRegister, 0x00, &interruptIndicator, 1);
+    readCommonRegister<CommonRegister::SocketInterrupt>(&interruptIndicator);
 
     for (uint8_t i = 0; i < 8; i++)
     {
@@ -210,44 +679,152 @@ bool W5500::resetSocketInterrupts(void)
         }
     }
 
-    readRegister(_socketInterruptRegister, 0x00, &interruptIndicator, 1);
+    readCommonRegister<CommonRegister::SocketInterrupt>(&interruptIndicator);
     return 0x00 == interruptIndicator;
 }
 
 void W5500::writeRegister(const uint16_t& addressWord,
                           const unsigned char& controlByte,
                           const unsigned char* dataByteArray,
-                          const uint8_t& dataByteCount)
+                          const uint16_t& dataByteCount)
 {
-    SpiDevice::select();
+    waitForTransferQueue();
+    W5500_TRACE_EVENT(TraceEvent::FrameStart, controlByte, addressWord);
 
-    SpiBus::sendByte(static_cast<uint8_t>(addressWord >> 8));
-    SpiBus::sendByte(static_cast<uint8_t>(addressWord & 0xff));
-    SpiBus::sendByte(controlByte);
-
-    for (uint8_t i = 0; i < dataByteCount; i++)
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+    for (uint16_t offset = 0; offset < dataByteCount;)
     {
-        SpiBus::sendByte(dataByteArray[i]);
+        const uint8_t chunkLength = getFixedLengthChunk(dataByteCount - offset);
+
+        transmitHeader(addressWord + offset, controlByte | getOperationMode(chunkLength));
+        transmitBlock(dataByteArray + offset, chunkLength);
+
+        offset += chunkLength;
     }
+#else
+    SpiDevice::select();
+
+    transmitHeader(addressWord, controlByte);
+    transmitBlock(dataByteArray, dataByteCount);
 
     SpiDevice::deselect();
+#endif
+
+    W5500_TRACE_EVENT(TraceEvent::FrameEnd, controlByte, dataByteCount);
 }
 
 void W5500::readRegister(const uint16_t& addressWord,
                          const unsigned char& controlByte,
                          unsigned char* dataByteArray,
-                         const uint8_t& dataByteCount)
+                         const uint16_t& dataByteCount)
 {
+    waitForTransferQueue();
+    W5500_TRACE_EVENT(TraceEvent::FrameStart, controlByte, addressWord);
+
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+    for (uint16_t offset = 0; offset < dataByteCount;)
+    {
+        const uint8_t chunkLength = getFixedLengthChunk(dataByteCount - offset);
+
+        transmitHeader(addressWord + offset, controlByte | getOperationMode(chunkLength));
+        receiveBlock(dataByteArray + offset, chunkLength);
+
+        offset += chunkLength;
+    }
+#else
     SpiDevice::select();
 
-    SpiBus::sendByte(addressWord >> 8);
-    SpiBus::sendByte(addressWord & 0xff);
-    SpiBus::sendByte(controlByte);
+    transmitHeader(addressWord, controlByte);
+    receiveBlock(dataByteArray, dataByteCount);
+
+    SpiDevice::deselect();
+#endif
+
+    W5500_TRACE_EVENT(TraceEvent::FrameEnd, controlByte, dataByteCount);
+}
+
+void W5500::transmitHeader(const uint16_t& addressWord, const unsigned char& controlByte)
+{
+    const unsigned char frameHeader[3] = {static_cast<unsigned char>(addressWord >> 8),
+                                          static_cast<unsigned char>(addressWord & 0xff),
+                                          controlByte};
+    transmitBlock(frameHeader, 3);
+}
 
-    for (uint8_t i = 0; i < dataByteCount; i++)
+uint8_t W5500::getFixedLengthChunk(const uint16_t& remainingByteCount)
+{
+    if (remainingByteCount >= 4)
     {
-        dataByteArray[i] = SpiBus::recvByte();
+        return 4;
     }
 
-    SpiDevice::deselect();
+    return remainingByteCount >= 2 ? 2 : 1;
+}
+
+unsigned char W5500::getOperationMode(const uint8_t& chunkLength)
+{
+    return 4 == chunkLength ? 0x03 : chunkLength;
+}
+
+void W5500::holdFixedLengthSelect(void)
+{
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+    SpiDevice::select();
+#endif
+}
+
+void W5500::transmitBlock(const unsigned char* dataByteArray, const uint16_t& dataByteCount)
+{
+    if (0 == dataByteCount)
+    {
+        return;
+    }
+
+    SPDR = dataByteArray[0];
+
+    for (uint16_t i = 1; i < dataByteCount; i++)
+    {
+        const unsigned char nextByte = dataByteArray[i];
+
+        while (!(SPSR & (1 << SPIF)))
+        {
+            ;
+        }
+
+        SPDR = nextByte;
+    }
+
+    while (!(SPSR & (1 << SPIF)))
+    {
+        ;
+    }
+}
+
+void W5500::receiveBlock(unsigned char* dataByteArray, const uint16_t& dataByteCount)
+{
+    if (0 == dataByteCount)
+    {
+        return;
+    }
+
+    SPDR = 0x00;
+
+    for (uint16_t i = 0; i < dataByteCount - 1; i++)
+    {
+        while (!(SPSR & (1 << SPIF)))
+        {
+            ;
+        }
+
+        const unsigned char receivedByte = SPDR;
+        SPDR = 0x00;
+        dataByteArray[i] = receivedByte;
+    }
+
+    while (!(SPSR & (1 << SPIF)))
+    {
+        ;
+    }
+
+    dataByteArray[dataByteCount - 1] = SPDR;
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "../address/host_address.hpp"
 #include "../address/mac_address.hpp"
 #include "../callback/callback.hpp"
+#include "event_ring.hpp"
+#include "register_map.hpp"
 #include "../socket/tcp_socket.hpp"
 #include "../socket/udp_socket.hpp"
 
@@ -68,6 +70,13 @@ public:
      */
     bool verify(void);
 
+    /**
+     *  \fn     isConfigured(void) const
+     *  \brief  Checks whether the constructor brought up the W5500 successfully.
+     *  \return Boolean indicating a verified chip and network configuration.
+     */
+    bool isConfigured(void) const;
+
     /**
      *  \fn         setMACAddress(const MacAddress& macAddress) const         
      *  \brief      Sets and validates the MAC address of the chip.
@@ -103,9 +112,82 @@ public:
     /**
      *  \fn     handleInterupt(void) 
      *  \brief  Handles an new issued hardware interupt.
+     *  \note   Performs SPI transfers and runs callbacks, so it must not be called from an ISR.
      */
     void handleInterrupt(void);
 
+    /**
+     *  \fn     notifyInterrupt(void)
+     *  \brief  Records a falling edge of INTn, meant to be called from the pin's ISR.
+     *
+     *  Only an event is queued, the SPI bus isn't touched. The socket
+     *  interrupts are read and dispatched by the next poll().
+     */
+    void notifyInterrupt(void);
+
+    /**
+     *  \fn     notifyTick(void)
+     *  \brief  Records a timer tick, meant to be called from a periodic timer ISR.
+     *
+     *  The next poll() passes the tick on to the sockets, which drives the
+     *  timer of their TX coalescing.
+     */
+    void notifyTick(void);
+
+    /**
+     *  \fn     poll(void)
+     *  \brief  Processes the events recorded by the ISRs, called from the main loop.
+     *  \return Boolean indicating whether any event was processed.
+     *
+     *  For an interrupt event, SIR is read and every flagged socket reads and
+     *  acknowledges its Sn_IR before its callbacks run. SIR is read again
+     *  until it is clear, because INTn produces no new edge while any flag is
+     *  still set.
+     */
+    bool poll(void);
+
+    /**
+     *  \fn         pollReadiness(uint8_t readiness[8])
+     *  \brief      Collects the readiness of all sockets like select() would.
+     *  \param[out] readiness passes the array receiving the SocketReadiness bits per socket index.
+     *  \return     The mask of sockets with any readiness bit set.
+     *
+     *  SIR is read once, and only the flagged sockets take a snapshot of
+     *  their registers, so an idle chip costs a single frame. Readable,
+     *  Writable and Closed are levels derived from the state cached since:
+     *  they are reported as long as received data is buffered, TX space is
+     *  free on a socket able to transmit, or the socket is closed. Connected
+     *  and TimedOut are edges reported once per interrupt. The levels rely
+     *  on the RECV, SEND_OK and DISCON interrupts being enabled. The read
+     *  flags are cleared and no callbacks are run. Use either this method or
+     *  the callbacks of poll() and handleInterrupt(), not both.
+     */
+    uint8_t pollReadiness(uint8_t readiness[8]);
+
+    /**
+     *  \fn         setInterruptCoalescing(const uint16_t& minimumLevel, const uint16_t& maximumLevel, const uint8_t& burstEventCount = 4)
+     *  \brief      Configures the range in which INTLEVEL adapts to the load.
+     *  \param[in]  minimumLevel passes the INTLEVEL used while traffic is light.
+     *  \param[in]  maximumLevel passes the largest INTLEVEL used under bursts.
+     *  \param[in]  burstEventCount passes the number of Sn_IR events per pass that counts as burst.
+     *
+     *  INTLEVEL delays the next assertion of INTn after the interrupt flags
+     *  were cleared. A pass handling at least burstEventCount events doubles
+     *  it, so further events are batched into the next pass, while a pass
+     *  handling at most one event halves it again for low latency. Passing
+     *  the same value twice fixes INTLEVEL, which is the default with 0xffff.
+     */
+    void setInterruptCoalescing(const uint16_t& minimumLevel,
+                                const uint16_t& maximumLevel,
+                                const uint8_t& burstEventCount = 4);
+
+    /**
+     *  \fn     getInterruptLevel(void) const
+     *  \brief  Returns the INTLEVEL value currently written to the chip.
+     *  \return The interrupt low level timer value.
+     */
+    uint16_t getInterruptLevel(void) const;
+
     /**
      *  \fn     resetSocketInterrupts(void)
      *  \brief  Resets all acitve socket interrupt flags.
@@ -113,12 +195,29 @@ public:
     bool resetSocketInterrupts(void);
 
     /**
-     * 	\fn		 	registerSocket(const AbstractSocket* socket)
-     * 	\brief 		Registers a new socket instance.
+     * 	\fn		 	registerSocket(AbstractSocket* socket, const uint8_t& txBufferSize, const uint8_t& rxBufferSize)
+     * 	\brief 		Registers a new socket instance and assigns its buffer memory.
      * 	\param[in]	socket passes a pointer to the socket instance to register.
-     * 	\return 	The index for the socket to specify.
+     *  \param[in]  txBufferSize passes the TX buffer size in KB (0, 1, 2, 4, 8 or 16).
+     *  \param[in]  rxBufferSize passes the RX buffer size in KB (0, 1, 2, 4, 8 or 16).
+     * 	\return 	The index for the socket to specify or invalidSocketIndex.
+     *
+     *  The 16 KB TX and 16 KB RX memories are shared by all sockets. The
+     *  registration fails if no hardware socket is free or the requested
+     *  sizes don't fit next to the buffers of the registered sockets. Buffers
+     *  of unregistered sockets are released to make room if necessary. As the
+     *  W5500 places the buffers one after the other, sizes should be assigned
+     *  before any socket is opened.
+     */
+    uint8_t registerSocket(AbstractSocket* socket,
+                           const uint8_t& txBufferSize = 2,
+                           const uint8_t& rxBufferSize = 2);
+
+    /**
+     *  \var    invalidSocketIndex
+     *  \brief  The index returned by registerSocket() on failure.
      */
-    uint8_t registerSocket(AbstractSocket* socket);
+    static constexpr uint8_t invalidSocketIndex = 0xff;
 
     /**
      *	\fn			unsubscribeSocket(const uint8_t& index)
@@ -127,7 +226,97 @@ public:
      */
     void unsubscribeSocket(const uint8_t& index);
 
+    /**
+     *  \fn     isTransferPending(void) const
+     *  \brief  Checks whether asynchronous SPI frames are queued or in flight.
+     *  \return Boolean indicating a pending asynchronous transfer.
+     */
+    bool isTransferPending(void) const;
+
+    /**
+     *  \fn     handleTransferInterrupt(void)
+     *  \brief  Continues the active asynchronous frame by one byte.
+     *  \note   Has to be called from the SPI transfer complete ISR (SPI_STC_vect).
+     *
+     *  The library only defines the ISR itself if W5500_SPI_ISR is defined,
+     *  so the vector stays free for other SPI drivers. Firmware sharing the
+     *  vector defines W5500_SPI_ISR_FORWARDED and calls this method from its
+     *  own ISR while isTransferPending() is true. Without either, nothing is
+     *  queued and asynchronous writes fall back to blocking ones.
+     */
+    static void handleTransferInterrupt(void);
+
 private:
+    /**
+     *  \struct TransferFrame
+     *  \brief  A W5500 SPI write frame queued for asynchronous transfer.
+     *
+     *  The referenced memory must stay valid until the completion function
+     *  is called.
+     */
+    struct TransferFrame
+    {
+        uint16_t addressWord;
+        unsigned char controlByte;
+        const unsigned char* txData;
+        uint16_t dataByteCount;
+        void (*onComplete)(void);
+    };
+
+    /**
+     *  \fn         writeRegisterAsync()
+     *  \brief      Queues a write frame that is driven by the SPI interrupt.
+     *  \param[in]  addressWord passes the register address to write to.
+     *  \param[in]  controlByte passes options for selecting various parameters.
+     *  \param[in]  dataByteArray passes the data to send as an byte array.
+     *  \param[in]  dataByteCount passes the length of the byte array.
+     *  \param[in]  onComplete passes the function to call after CS is released.
+     *  \return     Boolean indicating whether the frame could be queued, false for an
+     *              empty frame or if no ISR drives the queue.
+     *
+     *  The completion function is called from interrupt context. It may queue
+     *  further frames but must not use the blocking register accessors.
+     */
+    bool writeRegisterAsync(const uint16_t& addressWord,
+                            const unsigned char& controlByte,
+                            const unsigned char* dataByteArray,
+                            const uint16_t& dataByteCount,
+                            void (*onComplete)(void) = nullptr);
+
+    /**
+     *  \fn         enqueueTransfer(const TransferFrame& frame)
+     *  \brief      Appends the frame to the transfer queue and starts it if idle.
+     *  \param[in]  frame passes the frame to queue.
+     *  \return     Boolean indicating whether the queue had room for the frame.
+     */
+    bool enqueueTransfer(const TransferFrame& frame);
+
+    /**
+     *  \fn     startTransfer(void)
+     *  \brief  Selects the chip and clocks out the first byte of the head frame.
+     */
+    void startTransfer(void);
+
+    /**
+     *  \fn     startTransferChunk(void)
+     *  \brief  Clocks out the first header byte of the next chunk of the head frame.
+     *  \note   The whole frame is a single chunk in variable length data mode.
+     */
+    void startTransferChunk(void);
+
+    /**
+     *  \fn     continueTransfer(void)
+     *  \brief  Loads the next byte of the head frame.
+     */
+    void continueTransfer(void);
+
+    /**
+     *  \fn     waitForTransferQueue(void)
+     *  \brief  Blocks until all queued asynchronous frames are finished.
+     *  \note   Must not be called with interrupts disabled.
+     */
+    void waitForTransferQueue(void);
+
     /**
      * 	\fn			initRegister()
      * 	\brief		Initializes the basic registers of the 'W5500'.
@@ -135,8 +324,13 @@ private:
      * 	\param[in]	gatewayIPv4Address passes the gateways IPv4 address.
      * 	\param[in]	subnetMask passes the networks subnet mask.
      * 	\param[in]	sourceIPv4Address passes the IPv4 address to use.
+     *  \return     True if the network configuration was verified or verification is disabled.
+     *
+     *  GAR, SUBR, SHAR and SIPR are contiguous, so they are written in one
+     *  burst and verified by one burst read. Defining W5500_FAST_BOOT skips
+     *  the verification to shorten the bring-up after a reset.
      */
-    void initRegister(const MacAddress& macAddress,
+    bool initRegister(const MacAddress& macAddress,
                       const HostAddress& gatewayIPv4Address,
                       const SubnetMask& subnetMask,
                       const HostAddress& sourceIPv4Address);
@@ -149,17 +343,61 @@ private:
     void setInterruptLowLevelTimer(const uint16_t& value);
 
     /**
-     *	\fn			resetRegister(const uint16_t& registerAddress)
-     * 	\brief		Reset a register of the W5500 chip at the passed address.
-     * 	\param[in]	registerAddress passes the address of the register.
-     * 	\note 		Only working if MSB of register is a RST bit!
+     *  \fn     resetChip(void)
+     *  \brief  Performs a software reset of the W5500 and its PHY.
+     *
+     *  MR is set to RST in a single write. The PHY reset pulse is written as
+     *  read-modify-write of PHYCFGR, so the operation mode, whether strapped
+     *  by the PMODE pins or configured, stays as it was.
+     */
+    void resetChip(void);
+
+    /**
+     *  \fn         dispatchSocketInterrupts(uint8_t& eventCount)
+     *  \brief      Reads SIR and lets every flagged socket handle its interrupts.
+     *  \param[out] eventCount passes the counter the number of handled Sn_IR flags is added to.
+     *  \return     The SIR value read.
+     */
+    unsigned char dispatchSocketInterrupts(uint8_t& eventCount);
+
+    /**
+     *  \fn         adaptInterruptLevel(const uint8_t& eventCount)
+     *  \brief      Widens or narrows INTLEVEL according to the events of the last pass.
+     *  \param[in]  eventCount passes the number of Sn_IR flags handled.
+     */
+    void adaptInterruptLevel(const uint8_t& eventCount);
+
+    /**
+     *  \fn         getTXBufferSize(const uint8_t& index) const
+     *  \brief      Returns the TX buffer size allocated to a socket without SPI traffic.
+     *  \param[in]  index passes the hardware socket.
+     *  \return     The size of the socket's TX buffer in bytes.
      */
-    void resetRegister(const uint16_t& registerAddress);
+    uint16_t getTXBufferSize(const uint8_t& index) const;
+
+    /**
+     *  \fn         isValidBufferSize(const uint8_t& size)
+     *  \brief      Checks whether the passed size is accepted by Sn_TXBUF_SIZE and Sn_RXBUF_SIZE.
+     *  \param[in]  size passes the buffer size in KB.
+     *  \return     Boolean indicating a valid size.
+     */
+    static bool isValidBufferSize(const uint8_t& size);
+
+    /**
+     *  \fn         setSocketBufferSizes(const uint8_t& index, const uint8_t& txBufferSize, const uint8_t& rxBufferSize)
+     *  \brief      Writes Sn_RXBUF_SIZE and Sn_TXBUF_SIZE of a socket in one frame if they changed.
+     *  \param[in]  index passes the hardware socket to configure.
+     *  \param[in]  txBufferSize passes the TX buffer size in KB.
+     *  \param[in]  rxBufferSize passes the RX buffer size in KB.
+     */
+    void setSocketBufferSizes(const uint8_t& index, const uint8_t& txBufferSize, const uint8_t& rxBufferSize);
 
     /**
      *  \fn         enableSocketInterrupts(const unsigned char& interruptMask = 0xff)     
      *  \brief      Enables the socket interrupts according to passed mask.
      *  \param[in]  interruptMask passes the interrupt value for each sockets represented as bit. 
+     *
+     *  SIMR follows the registered sockets, so unused sockets never assert INTn.
      */
     void enableSocketInterrupts(const unsigned char& interruptMask = 0xff);
 
@@ -174,7 +412,7 @@ private:
     void writeRegister(const uint16_t& addressWord,
                        const unsigned char& controlByte,
                        const unsigned char* dataByteArray,
-                       const uint8_t& dataByteCount);
+                       const uint16_t& dataByteCount);
 
     /**
      * 	\fn			readRegister()
@@ -188,7 +426,93 @@ private:
     void readRegister(const uint16_t& addressWord,
                       const unsigned char& controlByte,
                       unsigned char* dataByteArray,
-                      const uint8_t& dataByteCount);
+                      const uint16_t& dataByteCount);
+
+    /**
+     *  \fn         writeCommonRegister(const unsigned char* dataByteArray)
+     *  \brief      Writes the common register passed as template argument.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[in]  dataByteArray passes the data of the register's width.
+     */
+    template<typename TargetRegister>
+    void writeCommonRegister(const unsigned char* dataByteArray)
+    {
+        static_assert(RegisterBlock::Common == TargetRegister::block, "Register is no common register.");
+        writeRegister(TargetRegister::address, TargetRegister::writeControlByte, dataByteArray, TargetRegister::width);
+    }
+
+    /**
+     *  \fn         readCommonRegister(unsigned char* dataByteArray)
+     *  \brief      Reads the common register passed as template argument.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[out] dataByteArray passes the array of the register's width to read into.
+     */
+    template<typename TargetRegister>
+    void readCommonRegister(unsigned char* dataByteArray)
+    {
+        static_assert(RegisterBlock::Common == TargetRegister::block, "Register is no common register.");
+        readRegister(TargetRegister::address, TargetRegister::readControlByte, dataByteArray, TargetRegister::width);
+    }
+
+    /**
+     *  \fn         transmitBlock(const unsigned char* dataByteArray, const uint16_t& dataByteCount)
+     *  \brief      Clocks the passed bytes out on the SPI bus back-to-back.
+     *  \param[in]  dataByteArray passes the data to send as an byte array.
+     *  \param[in]  dataByteCount passes the length of the byte array.
+     *
+     *  The next byte is fetched while the current one is still shifted out and
+     *  SPDR is reloaded as soon as SPIF is set. This keeps the gap between two
+     *  bytes down to a few cycles instead of a function call per byte.
+     */
+    void transmitBlock(const unsigned char* dataByteArray, const uint16_t& dataByteCount);
+
+    /**
+     *  \fn         transmitHeader(const uint16_t& addressWord, const unsigned char& controlByte)
+     *  \brief      Clocks out the address and control phase of an SPI frame.
+     *  \param[in]  addressWord passes the register address of the frame.
+     *  \param[in]  controlByte passes the control byte of the frame.
+     */
+    void transmitHeader(const uint16_t& addressWord, const unsigned char& controlByte);
+
+    /**
+     *  \fn         getFixedLengthChunk(const uint16_t& remainingByteCount)
+     *  \brief      Returns the largest fixed data length fitting the remaining bytes.
+     *  \param[in]  remainingByteCount passes the number of bytes left to transfer.
+     *  \return     The chunk length of 4, 2 or 1 byte.
+     */
+    static uint8_t getFixedLengthChunk(const uint16_t& remainingByteCount);
+
+    /**
+     *  \fn         getOperationMode(const uint8_t& chunkLength)
+     *  \brief      Returns the OM bits of the control byte for a fixed length frame.
+     *  \param[in]  chunkLength passes the data length of the frame.
+     *  \return     The OM bits selecting 1, 2 or 4 byte fixed length data mode.
+     */
+    static unsigned char getOperationMode(const uint8_t& chunkLength);
+
+    /**
+     *  \fn     holdFixedLengthSelect(void)
+     *  \brief  Asserts SCSn permanently if fixed length data mode is compiled in.
+     *
+     *  In fixed length data mode (W5500_FIXED_LENGTH_DATA_MODE) the W5500
+     *  delimits frames by the OM bits only, so SCSn stays low for the whole
+     *  session. Register accesses of up to four bytes, like Sn_SR, Sn_IR, SIR
+     *  and the buffer pointers, need no CS edges at all. Longer transfers are
+     *  split into 4 byte frames, which costs a header per chunk. The bus can't
+     *  be shared with other SPI devices in this mode.
+     */
+    void holdFixedLengthSelect(void);
+
+    /**
+     *  \fn         receiveBlock(unsigned char* dataByteArray, const uint16_t& dataByteCount)
+     *  \brief      Clocks the passed number of bytes in from the SPI bus back-to-back.
+     *  \param[out] dataByteArray passes the array to write the received data to.
+     *  \param[in]  dataByteCount passes the number of bytes to receive.
+     *
+     *  The dummy byte for the next transfer is loaded before the received byte
+     *  is stored, so the shift register is restarted as early as possible.
+     */
+    void receiveBlock(unsigned char* dataByteArray, const uint16_t& dataByteCount);
 
     /**
      *	\var 	_socketList
@@ -203,60 +527,124 @@ private:
     uint8_t _occupiedSocketMask = 0x00;
 
     /**
-     *  \var    _modeRegisterAddress
-     *  \brief  Used for S/W reset, ping block mode and PPPoE mode.
+     *  \var    _txBufferSizes
+     *  \brief  The Sn_TXBUF_SIZE values in KB as configured on the chip.
      */
-    const uint16_t _modeRegisterAddress = 0x0000;
+    uint8_t _txBufferSizes[8] = {2, 2, 2, 2, 2, 2, 2, 2};
 
     /**
-     *  \var    _gatewayAddrRegisterAddress
-     *  \brief  Configures the default gateway address.
+     *  \var    _rxBufferSizes
+     *  \brief  The Sn_RXBUF_SIZE values in KB as configured on the chip.
+     */
+    uint8_t _rxBufferSizes[8] = {2, 2, 2, 2, 2, 2, 2, 2};
+
+    /**
+     *  \var    _totalBufferSize
+     *  \brief  The size of the TX and of the RX memory in KB.
+     */
+    static constexpr uint8_t _totalBufferSize = 16;
+
+    /**
+     *  \var    _isConfigured
+     *  \brief  Indicates a successful bring-up of the W5500.
+     */
+    bool _isConfigured = false;
+
+    /**
+     *  \var    _transferQueueSize
+     *  \brief  Maximum number of queued asynchronous frames.
+     */
+    static constexpr uint8_t _transferQueueSize = 4;
+
+    /**
+     *  \var    _transferQueue
+     *  \brief  Ring buffer holding the queued asynchronous frames.
+     */
+    TransferFrame _transferQueue[_transferQueueSize] = {};
+
+    /**
+     *  \var    _transferHead
+     *  \brief  Index of the frame currently in flight.
+     */
+    volatile uint8_t _transferHead = 0;
 
+    /**
+     *  \var    _transferCount
+     *  \brief  Number of frames queued including the one in flight.
+     */
+    volatile uint8_t _transferCount = 0;
+
+    /**
+     *  \var    _transferOffset
+     *  \brief  Number of data bytes of the head frame already transferred.
+     */
+    uint16_t _transferOffset = 0;
+
+    /**
+     *  \var    _chunkLength
+     *  \brief  Number of data bytes in the chunk currently in flight.
+     */
+    uint16_t _chunkLength = 0;
+
+    /**
+     *  \var    _chunkPosition
+     *  \brief  Index of the byte of the current chunk being shifted.
+     */
+    uint16_t _chunkPosition = 0;
+
+    /**
+     *  \var    _activeTransferChip
+     *  \brief  The chip whose frame is driven by the SPI interrupt.
+     */
+    static W5500* _activeTransferChip;
+
+    /**
+     *  \var    _eventRingSize
+     *  \brief  Number of slots of the event ring.
      */
-    const uint16_t _gatewayAddrRegisterAddress = 0x0001;
+    static constexpr uint8_t _eventRingSize = 8;
 
     /**
-     *  \var    _subnetMaskRegisterAddress
-     *  \brief  Configures the subnet mask address.
+     *  \var    _maximumInterruptPasses
+     *  \brief  Number of SIR passes per poll() before other events get a turn.
      */
-    const uint16_t _subnetMaskRegisterAddress = 0x0005;
+    static constexpr uint8_t _maximumInterruptPasses = 4;
 
     /**
-     *  \var    _macAddrRegisterAddress
-     *  \brief  Configures the source hardware address
+     *  \var    _interruptLevel
+     *  \brief  Shadow copy of INTLEVEL.
      */
-    const uint16_t _macAddrRegisterAddress = 0x0009;
+    uint16_t _interruptLevel = 0xffff;
 
     /**
-     *  \var    _sourceAddrRegisterAddr
-     *  \brief  Configures the source IP address.
+     *  \var    _minimumInterruptLevel
+     *  \brief  INTLEVEL used while traffic is light.
      */
-    const uint16_t _sourceAddrRegisterAddress = 0x000f;
+    uint16_t _minimumInterruptLevel = 0xffff;
 
     /**
-     *  \var    _socketInterruptRegister
-     *  \brief  Indicates the socket that called an interrupt.
+     *  \var    _maximumInterruptLevel
+     *  \brief  Largest INTLEVEL used under bursts.
      */
-    const uint16_t _socketInterruptRegister = 0x0017;
+    uint16_t _maximumInterruptLevel = 0xffff;
 
     /**
-     *  \var    _socketInterruptMaskRegister
-     *  \brief  Configures socket's that call interrupts.
+     *  \var    _burstEventCount
+     *  \brief  Number of Sn_IR events per pass that widens INTLEVEL.
      */
-    const uint16_t _socketInterruptMaskRegister = 0x0018;
+    uint8_t _burstEventCount = 4;
 
     /**
-     *  \var    _pyhConfigRegisterAddress
-     *  \brief  Configures PHY operation mode and resets PHY. 
+     *  \var    _eventRing
+     *  \brief  Events recorded by the ISRs for poll().
      */
-    const uint16_t _phyConfigRegisterAddress = 0x002e;
+    EventRing<ChipEvent, _eventRingSize> _eventRing;
 
     /**
-     *  \var    _chipVersionRegisterAddress
-     *  \brief  Contains the chip version.
-     *  \note   VERSIONR always indicates the W5500 version as 0x04.
+     *  \var    _isInterruptMissed
+     *  \brief  Set if an interrupt event didn't fit into the ring.
      */
-    const uint16_t _chipVersionRegisterAddress = 0x0039;
+    volatile bool _isInterruptMissed = false;
 
     friend class AbstractSocket;
 };
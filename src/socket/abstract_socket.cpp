@@ -6,9 +6,26 @@
 #include "abstract_socket.hpp"
 
 #include "../chip/wiznet_w5500.hpp"
+#include "../trace/trace.hpp"
 #include <avr/io.h>
 #include <util/delay.h>
 
+namespace
+{
+/* The signals of the Sn_IR flags, indexed by their bit position. */
+void (AbstractSocket::*const socketSignals[])(void) = {&AbstractSocket::connected,
+                                                      &AbstractSocket::disconnected,
+                                                      &AbstractSocket::receivedMessage,
+                                                      &AbstractSocket::timedOut,
+                                                      &AbstractSocket::messageSent};
+
+/* Decodes a two byte register value in network byte order. */
+uint16_t toWord(const unsigned char* valueInBytes)
+{
+    return (static_cast<uint16_t>(valueInBytes[0]) << 8) + valueInBytes[1];
+}
+} // namespace
+
 AbstractSocket::AbstractSocket(void) {}
 
 AbstractSocket::~AbstractSocket(void)
@@ -26,74 +43,180 @@ uint8_t AbstractSocket::getIndex(void) const
 
 void AbstractSocket::setLocalPort(const uint16_t& port)
 {
-    constexpr uint16_t SnPORTRegisterAddress = 0x0004;
-    constexpr uint8_t byteCount = 2;
+    if ((_shadowValidMask & _shadowPortBit) && port == _localPort)
+    {
+        return;
+    }
+
+    writeSocketWord<SocketRegister::SourcePort>(port);
 
-    const unsigned char portInBytes[byteCount] = {static_cast<unsigned char>(0xff & (port >> 8)),
-                                                  static_cast<unsigned char>(0xff & port)};
+    _localPort = port;
 
-    writeControlRegister(SnPORTRegisterAddress, portInBytes, byteCount);
+    if (_chipInterface)
+    {
+        _shadowValidMask |= _shadowPortBit;
+    }
 }
 
 void AbstractSocket::open(void)
 {
-    constexpr unsigned char openBitmask = 0x01;
-    constexpr uint16_t SnCRRegisterAddress = 0x0001;
-    writeControlRegister(SnCRRegisterAddress, &openBitmask, 1);
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Open);
+
+    _shadowValidMask &= ~_shadowPointerBit;
+    loadBufferPointers();
+
+    _unsentTXLength = 0;
+    _unsentTXTicks = 0;
+    _isSendInProgress = false;
+    _isSendDeferred = false;
+}
+
+unsigned char AbstractSocket::getStatus(void) const
+{
+    return _status;
+}
+
+unsigned char AbstractSocket::refreshStatus(void)
+{
+    takeSnapshot(SnapshotPart::Status);
+    return _status;
+}
+
+void AbstractSocket::updateStatus(const unsigned char& status)
+{
+    if (status == _status)
+    {
+        return;
+    }
+
+    _status = status;
+    statusUpdated();
+}
+
+SocketSnapshot AbstractSocket::takeSnapshot(const uint8_t& parts)
+{
+    SocketSnapshot snapshot = {};
+
+    if (parts & SnapshotPart::Status)
+    {
+        unsigned char interruptAndStatus[SocketRegister::InterruptAndStatus::width] = {};
+        readSocketRegister<SocketRegister::InterruptAndStatus>(interruptAndStatus);
+
+        snapshot.interruptFlags = interruptAndStatus[0];
+        snapshot.status = interruptAndStatus[1];
+
+        _interruptFlags = snapshot.interruptFlags;
+        updateStatus(snapshot.status);
+    }
+
+    if (parts & (SnapshotPart::TXState | SnapshotPart::RXState))
+    {
+        /* The TX state is the first, the RX state the second half of the range. */
+        constexpr uint8_t halfWidth = SocketRegister::BufferState::width / 2;
+        const uint8_t begin = (parts & SnapshotPart::TXState) ? 0 : halfWidth;
+        const uint8_t end = (parts & SnapshotPart::RXState) ? SocketRegister::BufferState::width : halfWidth;
+
+        unsigned char bufferState[SocketRegister::BufferState::width] = {};
+        readControlRegister(SocketRegister::BufferState::address + begin, bufferState + begin, end - begin);
+
+        snapshot.txFreeSize = toWord(bufferState);
+        snapshot.txReadPointer = toWord(bufferState + 2);
+        snapshot.txWritePointer = toWord(bufferState + 4);
+        snapshot.rxReceivedSize = toWord(bufferState + 6);
+        snapshot.rxReadPointer = toWord(bufferState + 8);
+        snapshot.rxWritePointer = toWord(bufferState + 10);
+
+        /* Only the size registers change on their own, the pointers are
+           consistent with the burst read. */
+        if (parts & SnapshotPart::TXState)
+        {
+            snapshot.txFreeSize = readStableSocketWord<SocketRegister::TXFreeSize>(snapshot.txFreeSize);
+            _txFreeSize = snapshot.txFreeSize > _unsentTXLength ? snapshot.txFreeSize - _unsentTXLength : 0;
+        }
+
+        if (parts & SnapshotPart::RXState)
+        {
+            snapshot.rxReceivedSize = readStableSocketWord<SocketRegister::RXReceivedSize>(snapshot.rxReceivedSize);
+            _rxReceivedSize = snapshot.rxReceivedSize;
+        }
+    }
+
+    return snapshot;
+}
+
+void AbstractSocket::setMode(const unsigned char& mode)
+{
+    if ((_shadowValidMask & _shadowModeBit) && mode == _mode)
+    {
+        return;
+    }
+
+    writeSocketByte<SocketRegister::Mode>(mode);
+
+    _mode = mode;
+
+    if (_chipInterface)
+    {
+        _shadowValidMask |= _shadowModeBit;
+    }
+}
+
+void AbstractSocket::invalidateShadowRegisters(void)
+{
+    _shadowValidMask = 0x00;
 }
 
 void AbstractSocket::writeControlRegister(const uint16_t& addressWord,
                                           const unsigned char* dataByteArray,
-                                          const uint8_t& dataByteCount)
+                                          const uint16_t& dataByteCount)
 {
     if (_chipInterface)
     {
-        const unsigned char controlByte = 0x0C | (_index << 5);
-        _chipInterface->writeRegister(addressWord, controlByte, dataByteArray, dataByteCount);
+        constexpr unsigned char controlByte = getControlByte(RegisterBlock::Socket, true);
+        _chipInterface->writeRegister(addressWord, controlByte | _socketBlockBits, dataByteArray, dataByteCount);
     }
 }
 
 void AbstractSocket::readControlRegister(const uint16_t& addressWord,
                                          unsigned char* dataByteArray,
-                                         const uint8_t& dataByteCount)
+                                         const uint16_t& dataByteCount)
 {
     if (_chipInterface)
     {
-        const unsigned char controlByte = 0x08 | (_index << 5);
-        _chipInterface->readRegister(addressWord, controlByte, dataByteArray, dataByteCount);
+        constexpr unsigned char controlByte = getControlByte(RegisterBlock::Socket, false);
+        _chipInterface->readRegister(addressWord, controlByte | _socketBlockBits, dataByteArray, dataByteCount);
     }
 }
 
 void AbstractSocket::writeBufferRegister(const uint16_t& addressRegister,
                                          const unsigned char* data,
-                                         const uint8_t& length)
+                                         const uint16_t& length)
 {
     if (_chipInterface)
     {
-        const unsigned char controlByte = 0x14 | (_index << 5);
-        _chipInterface->writeRegister(addressRegister, controlByte, data, length);
+        constexpr unsigned char controlByte = getControlByte(RegisterBlock::SocketTXBuffer, true);
+        _chipInterface->writeRegister(addressRegister, controlByte | _socketBlockBits, data, length);
     }
 }
 
 void AbstractSocket::readRXBufferRegister(const uint16_t& addressRegister,
                                           unsigned char* data,
-                                          const uint8_t& length)
+                                          const uint16_t& length)
 {
     if (_chipInterface)
     {
-        const unsigned char controlByte = 0x18 | (_index << 5);
-        _chipInterface->readRegister(addressRegister, controlByte, data, length);
+        constexpr unsigned char controlByte = getControlByte(RegisterBlock::SocketRXBuffer, false);
+        _chipInterface->readRegister(addressRegister, controlByte | _socketBlockBits, data, length);
     }
 }
 
 void AbstractSocket::sendBuffer(void)
 {
-    constexpr unsigned char sendBitmask = 0x20;
-    constexpr uint16_t SnCRRegisterAddress = 0x0001;
-    writeControlRegister(SnCRRegisterAddress, &sendBitmask, 1);
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Send);
+    _isSendInProgress = true;
 }
 
-void AbstractSocket::send(const char* data)
+uint16_t AbstractSocket::send(const char* data)
 {
     uint16_t iterator = 0;
 
@@ -102,173 +225,701 @@ void AbstractSocket::send(const char* data)
         iterator++;
     }
 
-    uint16_t writePointerTX = getTXWritePointer();
+    return send(reinterpret_cast<const uint8_t*>(data), iterator);
+}
+
+uint16_t AbstractSocket::send(const uint8_t* data, const uint16_t& length)
+{
+    uint16_t sentByteCount = 0;
+
+    while (sentByteCount < length)
+    {
+        const uint16_t chunkLength = trySend(data + sentByteCount, length - sentByteCount);
+
+        if (0 == chunkLength && !canTransmit(_status))
+        {
+            break;
+        }
+
+        sentByteCount += chunkLength;
+    }
+
+    waitForDeferredSend();
+    return sentByteCount;
+}
+
+uint16_t AbstractSocket::trySend(const uint8_t* data, const uint16_t& length)
+{
+    if (!_chipInterface)
+    {
+        return 0;
+    }
+
+    const SocketSnapshot snapshot = refreshSendState(SnapshotPart::TXState);
+
+    if (!canTransmit(snapshot.status))
+    {
+        return 0;
+    }
+
+    uint16_t chunkLength = snapshot.txFreeSize;
+
+    if (chunkLength > length)
+    {
+        chunkLength = length;
+    }
+
+    if (chunkLength)
+    {
+        appendToTXBuffer(data, chunkLength);
+    }
+
+    if (chunkLength < length || _unsentTXLength >= _txCoalescingThreshold)
+    {
+        flush();
+    }
+
+    return chunkLength;
+}
+
+uint16_t AbstractSocket::send(const TxSegment* segments, const uint8_t& segmentCount)
+{
+    if (!_chipInterface)
+    {
+        return 0;
+    }
+
+    uint16_t length = 0;
+
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        if (segments[i].length > 0xffff - length)
+        {
+            return 0;
+        }
+
+        length += segments[i].length;
+    }
+
+    if (0 == length || length > _chipInterface->getTXBufferSize(_index))
+    {
+        return 0;
+    }
+
+    while (true)
+    {
+        const SocketSnapshot snapshot = refreshSendState(SnapshotPart::TXState);
+
+        if (!canTransmit(snapshot.status))
+        {
+            return 0;
+        }
+
+        if (snapshot.txFreeSize >= length)
+        {
+            break;
+        }
+
+        flush();
+    }
 
-    writeBufferRegister(writePointerTX, (unsigned char*) data, iterator);
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        if (segments[i].length)
+        {
+            appendToTXBuffer(segments[i].data, segments[i].length);
+        }
+    }
+
+    if (_unsentTXLength >= _txCoalescingThreshold)
+    {
+        flush();
+    }
+
+    waitForDeferredSend();
+    return length;
+}
+
+void AbstractSocket::setTXCoalescing(const uint16_t& byteThreshold, const uint16_t& tickLimit)
+{
+    _txCoalescingThreshold = byteThreshold;
+    _txCoalescingTickLimit = tickLimit;
+
+    if (_unsentTXLength >= _txCoalescingThreshold)
+    {
+        flush();
+    }
+}
+
+void AbstractSocket::flush(void)
+{
+    if (0 == _unsentTXLength)
+    {
+        return;
+    }
+
+    if (_isSendInProgress)
+    {
+        _isSendDeferred = true;
+        return;
+    }
 
-    setTXWritePointer(writePointerTX + iterator);
+    setTXWritePointer(_txWritePointer);
+    W5500_TRACE_EVENT(TraceEvent::Send, _index, _unsentTXLength);
     sendBuffer();
+
+    _unsentTXLength = 0;
+    _unsentTXTicks = 0;
+    _isSendDeferred = false;
+}
+
+void AbstractSocket::tick(void)
+{
+    if (_unsentTXLength && _txCoalescingTickLimit && ++_unsentTXTicks >= _txCoalescingTickLimit)
+    {
+        flush();
+    }
 }
 
-char* AbstractSocket::recv(void)
+uint16_t AbstractSocket::bufferData(const uint8_t* data, const uint16_t& length)
 {
-    unsigned char receivedSizeValue[2];
-    constexpr uint16_t SnRXRXRRegisterAddress = 0x0026;
-    readControlRegister(SnRXRXRRegisterAddress, receivedSizeValue, 2);
+    uint16_t bufferedByteCount = 0;
+
+    while (bufferedByteCount < length && _chipInterface)
+    {
+        const SocketSnapshot snapshot = refreshSendState(SnapshotPart::TXState);
+
+        if (!canTransmit(snapshot.status))
+        {
+            break;
+        }
+
+        uint16_t chunkLength = snapshot.txFreeSize;
+
+        if (chunkLength > length - bufferedByteCount)
+        {
+            chunkLength = length - bufferedByteCount;
+        }
+
+        if (chunkLength)
+        {
+            appendToTXBuffer(data + bufferedByteCount, chunkLength);
+            bufferedByteCount += chunkLength;
+        }
+
+        if (bufferedByteCount < length)
+        {
+            flush();
+        }
+    }
 
-    const uint16_t receivedByteCount = (static_cast<uint16_t>(receivedSizeValue[0]) << 8)
-                                       + receivedSizeValue[1];
+    return bufferedByteCount;
+}
+
+void AbstractSocket::commitData(void)
+{
+    if (_unsentTXLength >= _txCoalescingThreshold)
+    {
+        flush();
+    }
 
-    const uint16_t readPointer = getRXReadPointer();
+    waitForDeferredSend();
+}
 
-    unsigned char buffer[receivedByteCount] = {};
-    readRXBufferRegister(readPointer, buffer, receivedByteCount);
+SocketSnapshot AbstractSocket::refreshSendState(const uint8_t& parts)
+{
+    SocketSnapshot snapshot = takeSnapshot(SnapshotPart::Status | parts);
 
-    setRXReadPointer(readPointer + receivedByteCount);
+    /* Subtracted before completeSend() may SEND the pending bytes, which
+       the free size read above doesn't account for yet. */
+    snapshot.txFreeSize = snapshot.txFreeSize > _unsentTXLength ? snapshot.txFreeSize - _unsentTXLength : 0;
 
-    constexpr uint16_t SNCRRegisterAddress = 0x0001;
-    constexpr unsigned char receiveCommand = 0x40;
-    writeControlRegister(SNCRRegisterAddress, &receiveCommand, 1);
+    if (_isSendInProgress)
+    {
+        if (snapshot.interruptFlags & SocketInterrupt::SendOk)
+        {
+            writeSocketByte<SocketRegister::Interrupt>(SocketInterrupt::SendOk);
+            _pendingEvents |= SocketInterrupt::SendOk;
+            completeSend();
+            messageSent();
+        }
+        else if (!canTransmit(snapshot.status))
+        {
+            _isSendInProgress = false;
+            _isSendDeferred = false;
+        }
+    }
 
-    return nullptr;
+    return snapshot;
 }
 
-bool AbstractSocket::resetInterrupts(void)
+void AbstractSocket::completeSend(void)
+{
+    W5500_TRACE_EVENT(TraceEvent::SendComplete, _index, 0);
+
+    _interruptFlags &= ~SocketInterrupt::SendOk;
+    _isSendInProgress = false;
+
+    if (_isSendDeferred)
+    {
+        flush();
+    }
+}
+
+void AbstractSocket::waitForDeferredSend(void)
+{
+    while (_isSendDeferred && canTransmit(refreshSendState().status))
+    {
+        ;
+    }
+}
+
+void AbstractSocket::appendToTXBuffer(const uint8_t* data, const uint16_t& length)
+{
+    loadBufferPointers();
+    writeBufferRegister(_txWritePointer, data, length);
+
+    _txWritePointer += length;
+    _unsentTXLength += length;
+    _txFreeSize = _txFreeSize > length ? _txFreeSize - length : 0;
+}
+
+uint16_t AbstractSocket::sendAsync(const unsigned char* data,
+                                   const uint16_t& length,
+                                   void (*onComplete)(void))
+{
+    if (0 == length || !_chipInterface)
+    {
+        return 0;
+    }
+
+    const SocketSnapshot snapshot = refreshSendState(SnapshotPart::TXState);
+
+    if (!canTransmit(snapshot.status) || _isSendInProgress)
+    {
+        return 0;
+    }
+
+    uint16_t chunkLength = snapshot.txFreeSize;
+
+    if (chunkLength > length)
+    {
+        chunkLength = length;
+    }
+
+    if (0 == chunkLength)
+    {
+        return 0;
+    }
+
+    loadBufferPointers();
+
+    const uint16_t writePointerTX = _txWritePointer;
+    const uint16_t nextWritePointerTX = writePointerTX + chunkLength;
+    _txWritePointer = nextWritePointerTX;
+    _txFreeSize = snapshot.txFreeSize - chunkLength;
+    _unsentTXLength = 0;
+    _unsentTXTicks = 0;
+    _isSendInProgress = true;
+    _isSendDeferred = false;
+
+    W5500_TRACE_EVENT(TraceEvent::Send, _index, chunkLength);
+
+    _pendingTXWritePointer[0] = static_cast<unsigned char>((nextWritePointerTX >> 8) & 0xff);
+    _pendingTXWritePointer[1] = static_cast<unsigned char>(nextWritePointerTX & 0xff);
+
+    static const unsigned char sendCommand = SocketCommand::Send;
+
+    const unsigned char bufferControlByte = getControlByte(RegisterBlock::SocketTXBuffer, true)
+                                            | _socketBlockBits;
+    const unsigned char registerControlByte = getControlByte(RegisterBlock::Socket, true) | _socketBlockBits;
+
+    /* A frame not fitting into the transfer queue is written blocking. The
+       blocking write waits for the queued frames first, so the order holds. */
+    if (!_chipInterface->writeRegisterAsync(writePointerTX, bufferControlByte, data, chunkLength))
+    {
+        writeBufferRegister(writePointerTX, data, chunkLength);
+    }
+
+    if (!_chipInterface->writeRegisterAsync(SocketRegister::TXWritePointer::address,
+                                            registerControlByte,
+                                            _pendingTXWritePointer,
+                                            SocketRegister::TXWritePointer::width))
+    {
+        writeSocketRegister<SocketRegister::TXWritePointer>(_pendingTXWritePointer);
+    }
+
+    if (!_chipInterface->writeRegisterAsync(SocketRegister::Command::address,
+                                            registerControlByte,
+                                            &sendCommand,
+                                            SocketRegister::Command::width,
+                                            onComplete))
+    {
+        writeSocketByte<SocketRegister::Command>(SocketCommand::Send);
+
+        if (onComplete)
+        {
+            onComplete();
+        }
+    }
+
+    return chunkLength;
+}
+
+uint16_t AbstractSocket::available(void)
+{
+    return takeSnapshot(SnapshotPart::RXState).rxReceivedSize;
+}
+
+uint16_t AbstractSocket::recv(uint8_t* destination, const uint16_t& maximum)
+{
+    const uint16_t receivedByteCount = peek(destination, maximum);
+
+    if (receivedByteCount)
+    {
+        releaseRXBuffer(receivedByteCount);
+    }
+
+    return receivedByteCount;
+}
+
+uint16_t AbstractSocket::peek(uint8_t* destination, const uint16_t& maximum)
 {
-    constexpr uint16_t SnIRRegisterAddress = 0x0002;
-    unsigned char resetMask;
-    readControlRegister(SnIRRegisterAddress, &resetMask, 1);
-    writeControlRegister(SnIRRegisterAddress, &resetMask, 1);
+    uint16_t receivedByteCount = available();
 
-    unsigned char resetResult;
-    readControlRegister(SnIRRegisterAddress, &resetResult, 1);
+    if (receivedByteCount > maximum)
+    {
+        receivedByteCount = maximum;
+    }
+
+    if (receivedByteCount)
+    {
+        loadBufferPointers();
+        readRXBufferRegister(_rxReadPointer, destination, receivedByteCount);
+    }
 
-    return 0x00 == resetResult;
+    return receivedByteCount;
 }
 
-void AbstractSocket::addCallbackFunction(void (AbstractSocket::*signal)(void),
-                                         void (*callbackFunction)(void))
+uint16_t AbstractSocket::skip(const uint16_t& length)
 {
-    if (signal == &AbstractSocket::eventOccured)
+    uint16_t skippedByteCount = available();
+
+    if (skippedByteCount > length)
     {
-        _eventOccuredCallbackFunctionList.append(callbackFunction);
+        skippedByteCount = length;
     }
-    else if (signal == &AbstractSocket::receivedMessage)
+
+    if (skippedByteCount)
     {
-        _receivedMessageCallbackFunctionList.append(callbackFunction);
+        releaseRXBuffer(skippedByteCount);
     }
+
+    return skippedByteCount;
+}
+
+RxView AbstractSocket::view(void)
+{
+    return RxView(this, available());
+}
+
+uint16_t AbstractSocket::readUntil(uint8_t* destination, const uint16_t& capacity, const uint8_t& delimiter)
+{
+    RxView receivedData = view();
+
+    uint16_t recordLength = 0;
+    bool isComplete = false;
+
+    while (!isComplete && recordLength < capacity && recordLength < receivedData.size())
+    {
+        uint16_t chunkLength = capacity - recordLength;
+
+        if (chunkLength > _readChunkSize)
+        {
+            chunkLength = _readChunkSize;
+        }
+
+        chunkLength = receivedData.read(recordLength, destination + recordLength, chunkLength);
+
+        for (uint16_t i = 0; !isComplete && i < chunkLength; i++)
+        {
+            isComplete = delimiter == destination[recordLength + i];
+
+            if (isComplete)
+            {
+                chunkLength = i + 1;
+            }
+        }
+
+        recordLength += chunkLength;
+    }
+
+    if (!isComplete && recordLength < capacity)
+    {
+        return 0;
+    }
+
+    return receivedData.consume(recordLength);
+}
+
+uint16_t AbstractSocket::readLine(char* destination, const uint16_t& capacity)
+{
+    if (0 == capacity)
+    {
+        return 0;
+    }
+
+    const uint16_t consumedLength = readUntil(reinterpret_cast<uint8_t*>(destination), capacity - 1, '\n');
+    uint16_t lineLength = consumedLength;
+
+    if (lineLength && '\n' == destination[lineLength - 1])
+    {
+        lineLength--;
+
+        if (lineLength && '\r' == destination[lineLength - 1])
+        {
+            lineLength--;
+        }
+    }
+
+    destination[lineLength] = '\0';
+    return consumedLength;
 }
 
-void AbstractSocket::addCallback(void (AbstractSocket::*signal)(void), Callback& callback)
+bool AbstractSocket::canTransmit(const unsigned char& status)
 {
-    if (signal == &AbstractSocket::eventOccured)
+    return SocketStatus::Established == status || SocketStatus::CloseWait == status
+           || SocketStatus::Udp == status || SocketStatus::MacRaw == status;
+}
+
+bool AbstractSocket::resetInterrupts(void)
+{
+    const unsigned char resetMask = readSocketByte<SocketRegister::Interrupt>();
+
+    if (resetMask)
     {
-        _eventOccuredCallbackInstanceList.append(callback);
+        writeSocketByte<SocketRegister::Interrupt>(resetMask);
     }
-    else if (signal == &AbstractSocket::receivedMessage)
+
+    if (_isSendInProgress && (resetMask & SocketInterrupt::SendOk))
     {
-        _receivedMessageCallbackInstanceList.append(callback);
+        completeSend();
     }
+
+    const unsigned char ignoredMask = _isSendInProgress ? SocketInterrupt::SendOk : 0x00;
+    return 0x00 == (readSocketByte<SocketRegister::Interrupt>() & ~ignoredMask);
+}
+
+bool AbstractSocket::addCallbackFunction(const SocketEvent& event, void (*callbackFunction)(void))
+{
+    return _eventDelegates[static_cast<uint8_t>(event)].append(callbackFunction);
 }
 
-void AbstractSocket::enableInterrupts(const unsigned char& interruptMask)
+bool AbstractSocket::addCallback(const SocketEvent& event, Callback& callback)
 {
-    constexpr uint16_t SnIMRRegisterAddress = 0x002c;
-    writeControlRegister(SnIMRRegisterAddress, &interruptMask, 1);
+    return _eventDelegates[static_cast<uint8_t>(event)].append(callback);
+}
+
+bool AbstractSocket::addReceiveCallbackFunction(void (*callbackFunction)(AbstractSocket&, RxView&))
+{
+    return _receiveDelegates.append(callbackFunction);
+}
+
+bool AbstractSocket::addReceiveCallback(ReceiveCallback& callback)
+{
+    return _receiveDelegates.append(callback);
+}
+
+unsigned char AbstractSocket::takePendingEvents(const unsigned char& interruptMask)
+{
+    const unsigned char pendingEvents = _pendingEvents & interruptMask;
+    _pendingEvents &= ~interruptMask;
+
+    return pendingEvents;
 }
 
-void AbstractSocket::eventOccured(void)
+void AbstractSocket::setInterruptMask(const unsigned char& interruptMask)
 {
-    unsigned char interruptRegister;
-    constexpr uint16_t SnIRRegisterAddress = 0x0002;
-    readControlRegister(SnIRRegisterAddress, &interruptRegister, 1);
+    const unsigned char requiredMask = interruptMask | SocketInterrupt::SendOk | SocketInterrupt::TimedOut;
 
-    for (void (*onEventCallback)(void) : _eventOccuredCallbackFunctionList)
+    if ((_shadowValidMask & _shadowInterruptMaskBit) && requiredMask == _interruptMask)
     {
-        onEventCallback();
+        return;
     }
 
-    for (Callback callbackInstance : _eventOccuredCallbackInstanceList)
+    writeSocketByte<SocketRegister::InterruptMask>(requiredMask);
+
+    _interruptMask = requiredMask;
+
+    if (_chipInterface)
     {
-        callbackInstance.fire();
+        _shadowValidMask |= _shadowInterruptMaskBit;
     }
+}
 
-    if (interruptRegister & (1 << 0x00))
-        connected();
+unsigned char AbstractSocket::eventOccured(void)
+{
+    const unsigned char interruptRegister = takeSnapshot(SnapshotPart::Status).interruptFlags;
+    _pendingEvents |= interruptRegister;
 
-    if (interruptRegister & (1 << 0x01))
-        disconnected();
+    if (interruptRegister)
+    {
+        writeSocketByte<SocketRegister::Interrupt>(interruptRegister);
+    }
 
-    if (interruptRegister & (1 << 0x02))
-        receivedMessage();
+    /* The SEND_OK is cleared already, a callback sending data must not wait for it. */
+    if ((interruptRegister & SocketInterrupt::SendOk) && _isSendInProgress)
+    {
+        completeSend();
+    }
 
-    if (interruptRegister & (1 << 0x03))
-        timedOut();
+    fireDelegates(SocketEvent::Any);
 
-    if (interruptRegister & (1 << 0x04))
-        messageSent();
+    for (uint8_t i = 0; i < sizeof(socketSignals) / sizeof(socketSignals[0]); i++)
+    {
+        if (interruptRegister & (1 << i))
+        {
+            (this->*socketSignals[i])();
+        }
+    }
+
+    return interruptRegister;
 }
 
 void AbstractSocket::connected(void)
 {
-    send("Connected to 192.168.178.101!\n\r");
+    fireDelegates(SocketEvent::Connected);
 }
 
-void AbstractSocket::disconnected(void) {}
+void AbstractSocket::disconnected(void)
+{
+    fireDelegates(SocketEvent::Disconnected);
+}
 
 void AbstractSocket::receivedMessage(void)
 {
-    for (void (*onNewMessageCallbackFunction)(void) : _receivedMessageCallbackFunctionList)
+    fireDelegates(SocketEvent::Received);
+
+    if (_receiveDelegates.isEmpty())
+    {
+        return;
+    }
+
+    RxView receivedData = view();
+    _receiveDelegates.fire(*this, receivedData);
+}
+
+void AbstractSocket::timedOut(void)
+{
+    _isSendInProgress = false;
+    _isSendDeferred = false;
+    _pendingEvents |= SocketInterrupt::TimedOut;
+
+    fireDelegates(SocketEvent::TimedOut);
+}
+
+void AbstractSocket::messageSent(void)
+{
+    fireDelegates(SocketEvent::SendOk);
+}
+
+uint8_t AbstractSocket::takeReadiness(unsigned char& interruptFlags)
+{
+    const unsigned char interruptRegister = takeSnapshot(SnapshotPart::All).interruptFlags;
+    interruptFlags = interruptRegister;
+    _pendingEvents |= interruptRegister;
+
+    if (interruptRegister)
+    {
+        writeSocketByte<SocketRegister::Interrupt>(interruptRegister);
+    }
+
+    uint8_t readiness = 0x00;
+
+    if ((interruptRegister & SocketInterrupt::SendOk) && _isSendInProgress)
+    {
+        completeSend();
+    }
+
+    if (interruptRegister & SocketInterrupt::Connected)
+    {
+        readiness |= SocketReadiness::Connected;
+    }
+
+    if (interruptRegister & SocketInterrupt::TimedOut)
     {
-        onNewMessageCallbackFunction();
+        readiness |= SocketReadiness::TimedOut;
+        _isSendInProgress = false;
+        _isSendDeferred = false;
     }
 
-    for (Callback callbackInstance : _receivedMessageCallbackInstanceList)
+    if (interruptRegister & SocketInterrupt::Disconnected)
     {
-        callbackInstance.fire();
+        readiness |= SocketReadiness::Closed;
     }
+
+    return readiness;
 }
 
-void AbstractSocket::timedOut(void) {}
+uint8_t AbstractSocket::getReadinessLevel(void) const
+{
+    uint8_t readiness = 0x00;
+
+    if (_rxReceivedSize)
+    {
+        readiness |= SocketReadiness::Readable;
+    }
+
+    if (_txFreeSize && canTransmit(_status))
+    {
+        readiness |= SocketReadiness::Writable;
+    }
 
-void AbstractSocket::messageSent(void) {}
+    if (SocketStatus::Closed == _status || SocketStatus::CloseWait == _status)
+    {
+        readiness |= SocketReadiness::Closed;
+    }
 
-uint16_t AbstractSocket::getTXWritePointer(void)
+    return readiness;
+}
+
+void AbstractSocket::fireDelegates(const SocketEvent& event)
 {
-    unsigned char lengthArray[2] = {};
-    constexpr uint16_t SnTXWRRegisterAddress = 0x0024;
-    readControlRegister(SnTXWRRegisterAddress, lengthArray, 2);
-    return (static_cast<uint16_t>(lengthArray[0]) << 8) + lengthArray[1];
+    _eventDelegates[static_cast<uint8_t>(event)].fire();
 }
 
-uint16_t AbstractSocket::getRXReadPointer(void)
+void AbstractSocket::setRXReadPointer(const uint16_t position)
 {
-    unsigned char lengthArray[2] = {};
-    constexpr uint16_t SnRXRDRegisterAddress = 0x0028;
-    readControlRegister(SnRXRDRegisterAddress, lengthArray, 2);
-    return (static_cast<uint16_t>(lengthArray[0]) << 8) + lengthArray[1];
+    writeSocketWord<SocketRegister::RXReadPointer>(position);
+    _rxReadPointer = position;
 }
 
-uint16_t AbstractSocket::getRXWritePointer(void)
+void AbstractSocket::loadBufferPointers(void)
 {
-    unsigned char lengthArray[2] = {};
-    constexpr uint16_t SnRXWRRegisterAddress = 0x002a;
-    readControlRegister(SnRXWRRegisterAddress, lengthArray, 2);
-    return (static_cast<uint16_t>(lengthArray[0]) << 8) + lengthArray[1];
+    if ((_shadowValidMask & _shadowPointerBit) || !_chipInterface)
+    {
+        return;
+    }
+
+    const SocketSnapshot snapshot = takeSnapshot();
+    _txWritePointer = snapshot.txWritePointer;
+    _rxReadPointer = snapshot.rxReadPointer;
+    _shadowValidMask |= _shadowPointerBit;
 }
 
-void AbstractSocket::setRXReadPointer(const uint16_t position)
+void AbstractSocket::releaseRXBuffer(const uint16_t& length)
 {
-    const unsigned char lengthArray[2] = {static_cast<unsigned char>((position >> 8) & 0xff),
-                                          static_cast<unsigned char>(position & 0xff)};
-    constexpr uint16_t SnRXRDRegisterAddress = 0x0028;
-    writeControlRegister(SnRXRDRegisterAddress, lengthArray, 2);
+    loadBufferPointers();
+    W5500_TRACE_EVENT(TraceEvent::Receive, _index, length);
+
+    setRXReadPointer(_rxReadPointer + length);
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Receive);
+
+    _rxReceivedSize = _rxReceivedSize > length ? _rxReceivedSize - length : 0;
 }
 
 void AbstractSocket::setTXWritePointer(const uint16_t& length)
 {
-    const unsigned char lengthArray[2] = {static_cast<unsigned char>((length >> 8) & 0xff),
-                                          static_cast<unsigned char>(length & 0xff)};
-    constexpr uint16_t SnRXWRRegisterAddress = 0x0024;
-    writeControlRegister(SnRXWRRegisterAddress, lengthArray, 2);
+    writeSocketWord<SocketRegister::TXWritePointer>(length);
+    _txWritePointer = length;
 }
\ No newline at end of file
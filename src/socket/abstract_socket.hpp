@@ -8,11 +8,48 @@
 
 class W5500;
 
-#include <avr_container.hpp>
 #include <stdint.h>
 
 #include "../callback/callback.hpp"
 #include "../callback/callback_instance.hpp"
+#include "../callback/delegate.hpp"
+#include "../callback/delegate_table.hpp"
+#include "../callback/receive_callback.hpp"
+#include "../chip/register_map.hpp"
+#include "rx_view.hpp"
+#include "socket_snapshot.hpp"
+#include "tx_segment.hpp"
+#include "tx_writer.hpp"
+
+/**
+ *  \enum   SocketEvent
+ *  \brief  The socket events callbacks can be added to.
+ *
+ *  The values of the single events are the bit indices of their Sn_IR flag.
+ *  'Any' is emitted for every interrupt pass of the socket.
+ */
+enum class SocketEvent : uint8_t
+{
+    Connected = 0,
+    Disconnected = 1,
+    Received = 2,
+    TimedOut = 3,
+    SendOk = 4,
+    Any = 5
+};
+
+/**
+ *  \namespace  SocketReadiness
+ *  \brief      The bits of a socket's readiness as returned by W5500::pollReadiness().
+ */
+namespace SocketReadiness
+{
+constexpr uint8_t Readable = 0x01;
+constexpr uint8_t Writable = 0x02;
+constexpr uint8_t Connected = 0x04;
+constexpr uint8_t Closed = 0x08;
+constexpr uint8_t TimedOut = 0x10;
+} // namespace SocketReadiness
 
 /**
  *  \class  AbstractSocket
@@ -34,12 +71,18 @@ public:
     ~AbstractSocket(void);
 
     /**
-     *  \fn             
-     *  \brief 
+     *  \fn             bind(W5500* chipInterface, const uint16_t& port, const uint8_t& txBufferSize, const uint8_t& rxBufferSize)
+     *  \brief          Binds the socket to a port of the passed chip.
      *  \param[inout]   chipInterface passes a pointer to the W5500 interface instance.
      *  \param[in]      port passes the 16 bit source port value.
+     *  \param[in]      txBufferSize passes the TX buffer size in KB.
+     *  \param[in]      rxBufferSize passes the RX buffer size in KB.
      */
-    virtual void bind(W5500* chipInterface, const uint16_t& port) = 0;
+    virtual void bind(W5500* chipInterface,
+                      const uint16_t& port,
+                      const uint8_t& txBufferSize = 2,
+                      const uint8_t& rxBufferSize = 2)
+        = 0;
 
     /**
      *  \fn     open(void)
@@ -61,6 +104,57 @@ public:
      */
     void setLocalPort(const uint16_t& port);
 
+    /**
+     *  \fn       getStatus(void) const
+     *  \brief    Returns the Sn_SR value seen by the last interrupt or poll.
+     *  \return   The cached socket status without SPI traffic.
+     */
+    unsigned char getStatus(void) const;
+
+    /**
+     *  \fn       refreshStatus(void)
+     *  \brief    Reads Sn_SR from the chip and updates the cached status.
+     *  \return   The current socket status.
+     */
+    unsigned char refreshStatus(void);
+
+    /**
+     *  \fn         takeSnapshot(const uint8_t& parts = SnapshotPart::All)
+     *  \brief      Reads Sn_IR, Sn_SR and the buffer state registers in as few frames as possible.
+     *  \param[in]  parts passes the SnapshotPart bits selecting the registers to read.
+     *  \return     The snapshot of the socket's state.
+     *
+     *  Sn_IR and Sn_SR take one frame, the TX and RX state registers from
+     *  Sn_TX_FSR to Sn_RX_WR another one. The cached status is updated as
+     *  well, so getStatus() reflects the snapshot afterwards.
+     */
+    SocketSnapshot takeSnapshot(const uint8_t& parts = SnapshotPart::All);
+
+    /**
+     *  \fn         takePendingEvents(const unsigned char& interruptMask)
+     *  \brief      Returns and clears the Sn_IR events seen since they were last taken.
+     *  \param[in]  interruptMask passes the SocketInterrupt bits to take.
+     *  \return     The pending events among the passed bits.
+     *
+     *  The events are collected without SPI traffic by the interrupt passes,
+     *  W5500::pollReadiness() and expired connection deadlines. SocketTask
+     *  uses them to resume only tasks whose awaited event arrived.
+     */
+    unsigned char takePendingEvents(const unsigned char& interruptMask);
+
+    /**
+     *  \fn         setInterruptMask(const unsigned char& interruptMask)
+     *  \brief      Selects the Sn_IR events that are latched and may assert INTn.
+     *  \param[in]  interruptMask passes the SocketInterrupt bits to enable.
+     *
+     *  SEND_OK and TIMEOUT stay enabled, since the send pipeline depends on
+     *  them. Masked events are neither reported to callbacks nor to
+     *  W5500::pollReadiness(), so a socket that only transmits can mask RECV
+     *  and CON to save interrupt passes. Sn_IMR is only written if the mask
+     *  changed.
+     */
+    void setInterruptMask(const unsigned char& interruptMask);
+
     /**
      *  \fn       isOpen(void)
      *  \brief    Checks whether the socket is open or not.
@@ -73,15 +167,177 @@ public:
      *  \fn         send(const char* data)
      *  \brief      Sends the passes string to it's destination.
      *  \param[in]  data passes the C string to send.
+     *  \return     The number of bytes accepted by the TX buffer.
+     */
+    uint16_t send(const char* data);
+
+    /**
+     *  \fn         send(const uint8_t* data, const uint16_t& length)
+     *  \brief      Sends the passed data, blocking until all of it is buffered.
+     *  \param[in]  data passes the data to send.
+     *  \param[in]  length passes the number of bytes to send.
+     *  \return     The number of bytes accepted by the TX buffer.
+     *
+     *  The data is written straight from the passed memory into the TX
+     *  buffer. If it doesn't fit into Sn_TX_FSR, it is sent in chunks as
+     *  space becomes free. The method returns early with a smaller count if
+     *  the connection is lost meanwhile.
+     *
+     *  Only one SEND is in flight at a time. While the chip transmits a
+     *  chunk, the next one is already written into the free TX space and its
+     *  SEND is issued as soon as SEND_OK shows up.
+     */
+    uint16_t send(const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \fn         trySend(const uint8_t* data, const uint16_t& length)
+     *  \brief      Sends as much of the passed data as fits into the TX buffer.
+     *  \param[in]  data passes the data to send.
+     *  \param[in]  length passes the number of bytes to send.
+     *  \return     The number of bytes accepted, zero if the buffer is full.
+     *
+     *  The method never waits for free space. Unsent bytes have to be passed
+     *  again by the caller later on. If a SEND is still in flight, the data
+     *  is buffered and sent when SEND_OK is handled, either by the interrupt
+     *  path or by the next send call.
+     */
+    uint16_t trySend(const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \fn         send(const TxSegment* segments, const uint8_t& segmentCount)
+     *  \brief      Sends several segments as one message.
+     *  \param[in]  segments passes the array of segments to send in order.
+     *  \param[in]  segmentCount passes the number of segments.
+     *  \return     The number of bytes sent, zero if the message couldn't be sent.
+     *
+     *  The segments are written back-to-back into the TX buffer and a single
+     *  SEND is issued, so they don't need to be assembled in SRAM first. The
+     *  method waits until the whole message fits into Sn_TX_FSR. Messages
+     *  larger than the socket's TX buffer or than 64 KB are rejected.
+     */
+    uint16_t send(const TxSegment* segments, const uint8_t& segmentCount);
+
+    /**
+     *  \fn         setTXCoalescing(const uint16_t& byteThreshold, const uint16_t& tickLimit = 0)
+     *  \brief      Configures how small writes are combined into one SEND.
+     *  \param[in]  byteThreshold passes the number of pending bytes triggering SEND.
+     *  \param[in]  tickLimit passes the number of tick() calls after which pending data is sent.
+     *
+     *  With a threshold of zero, which is the default, every write is sent
+     *  immediately. Otherwise writes only append to the TX buffer and advance
+     *  the cached Sn_TX_WR. SEND is issued by flush(), when the threshold is
+     *  reached, when the TX buffer runs full or when tick() was called
+     *  tickLimit times since the first pending write. A tick limit of zero
+     *  disables the timer. For UDP sockets all pending writes form a single
+     *  datagram.
+     */
+    void setTXCoalescing(const uint16_t& byteThreshold, const uint16_t& tickLimit = 0);
+
+    /**
+     *  \fn     flush(void)
+     *  \brief  Sends all data appended to the TX buffer since the last SEND.
+     *  \note   While a SEND is in flight, the data is sent once SEND_OK arrives.
+     */
+    void flush(void);
+
+    /**
+     *  \fn     tick(void)
+     *  \brief  Advances the coalescing timer, meant to be called periodically from the main loop.
+     */
+    virtual void tick(void);
+
+    /**
+     *  \fn         sendAsync(const unsigned char* data, const uint16_t& length, void (*onComplete)(void))
+     *  \brief      Sends the passed data without blocking during the SPI transfer.
+     *  \param[in]  data passes the data to send. It must stay valid until completion.
+     *  \param[in]  length passes the number of bytes to send.
+     *  \param[in]  onComplete passes the function to call when SEND was issued.
+     *  \return     The number of bytes queued, zero for empty data, while a SEND is in flight or the TX buffer is full.
+     *
+     *  The buffer write, the TX write pointer update and the SEND command are
+     *  queued as three frames on the chip and are clocked out by the SPI
+     *  interrupt, which has to reach W5500::handleTransferInterrupt(). The
+     *  completion function runs in interrupt context. Data
+     *  still pending from coalesced writes is sent along. Like trySend(),
+     *  the length is clamped to the free TX buffer space, so the caller
+     *  retries with the remaining data. Frames not fitting into the transfer
+     *  queue are written blocking instead, in which case the completion
+     *  function is called before the method returns. Unless W5500_SPI_ISR or
+     *  W5500_SPI_ISR_FORWARDED is defined, all frames are written blocking.
+     */
+    uint16_t sendAsync(const unsigned char* data,
+                       const uint16_t& length,
+                       void (*onComplete)(void) = nullptr);
+
+    /**
+     *  \fn         available(void)
+     *  \brief      Returns the number of received bytes waiting in the RX buffer.
+     *  \return     The value of Sn_RX_RSR, taken with a snapshot of the RX state.
+     */
+    uint16_t available(void);
+
+    /**
+     *  \fn         recv(uint8_t* destination, const uint16_t& maximum)
+     *  \brief      Moves received data into the caller's buffer.
+     *  \param[out] destination passes the buffer to copy the data into.
+     *  \param[in]  maximum passes the capacity of the buffer.
+     *  \return     The number of bytes copied, zero if nothing was received.
+     *
+     *  The data is read in one burst, then Sn_RX_RD is advanced and RECV is
+     *  issued once for the whole batch.
+     */
+    uint16_t recv(uint8_t* destination, const uint16_t& maximum);
+
+    /**
+     *  \fn         peek(uint8_t* destination, const uint16_t& maximum)
+     *  \brief      Copies received data without removing it from the RX buffer.
+     *  \param[out] destination passes the buffer to copy the data into.
+     *  \param[in]  maximum passes the capacity of the buffer.
+     *  \return     The number of bytes copied.
      */
-    void send(const char* data);
+    uint16_t peek(uint8_t* destination, const uint16_t& maximum);
 
     /**
-     *  \fn         recv(void)
-     *  \brief      Receives new messages from peer.     
-     *  \return     Char array containing the data.
+     *  \fn         skip(const uint16_t& length)
+     *  \brief      Discards received data without reading it over SPI.
+     *  \param[in]  length passes the number of bytes to discard.
+     *  \return     The number of bytes discarded.
      */
-    char* recv(void);
+    uint16_t skip(const uint16_t& length);
+
+    /**
+     *  \fn         view(void)
+     *  \brief      Returns a view on the received data for parsing in place.
+     *  \return     The view covering the unread RX buffer region.
+     */
+    RxView view(void);
+
+    /**
+     *  \fn         readUntil(uint8_t* destination, const uint16_t& capacity, const uint8_t& delimiter)
+     *  \brief      Receives a record terminated by the passed delimiter.
+     *  \param[out] destination passes the buffer to copy the record into.
+     *  \param[in]  capacity passes the size of the buffer.
+     *  \param[in]  delimiter passes the byte terminating a record.
+     *  \return     The number of bytes consumed, zero if no complete record is buffered.
+     *
+     *  The RX buffer is read in small chunks straight into the destination
+     *  until the delimiter shows up. Only the record including its delimiter
+     *  is consumed, the following data stays in the RX buffer. A record not
+     *  fitting into the destination is returned truncated to the capacity,
+     *  recognizable by the missing delimiter at its end.
+     */
+    uint16_t readUntil(uint8_t* destination, const uint16_t& capacity, const uint8_t& delimiter);
+
+    /**
+     *  \fn         readLine(char* destination, const uint16_t& capacity)
+     *  \brief      Receives a line terminated by "\n" or "\r\n".
+     *  \param[out] destination passes the buffer for the line as a C string.
+     *  \param[in]  capacity passes the size of the buffer including the NUL.
+     *  \return     The number of bytes consumed, zero if no complete line is buffered.
+     *
+     *  The line terminator is stripped from the returned string.
+     */
+    uint16_t readLine(char* destination, const uint16_t& capacity);
 
     /**
      *  \fn         resetInterrupts(void)
@@ -91,33 +347,63 @@ public:
     bool resetInterrupts(void);
 
     /**
-     *  \fn         addCallbackFunction(void (AbstractSocket::*signal)(void), void (*callbackFunction)(void))
-     *  \brief      Adds the callback function to a specified signal of the socket.
-     *  \param[in]  singal passes the signal to add the callback function to.
-     *  \param[in]  callbackFunction passes the function to call when sinal is emitted.
+     *  \fn         addCallbackFunction(const SocketEvent& event, void (*callbackFunction)(void))
+     *  \brief      Adds the callback function to a specified event of the socket.
+     *  \param[in]  event passes the event to add the callback function to.
+     *  \param[in]  callbackFunction passes the function to call when the event occurs.
+     *  \return     Boolean indicating whether the event's delegate table had room left.
+     */
+    bool addCallbackFunction(const SocketEvent& event, void (*callbackFunction)(void));
+
+    /**
+     *  \fn         addCallback(const SocketEvent& event, Callback& callback)
+     *  \brief      Adds the callback instance to a specified event of the socket.
+     *  \param[in]  event passes the event to add the callback to.
+     *  \param[in]  callback passes the instance to call when the event occurs.
+     *  \return     Boolean indicating whether the event's delegate table had room left.
+     */
+    bool addCallback(const SocketEvent& event, Callback& callback);
+
+    /**
+     *  \fn         addReceiveCallbackFunction(void (*callbackFunction)(AbstractSocket&, RxView&))
+     *  \brief      Adds a function receiving the socket and its received data.
+     *  \param[in]  callbackFunction passes the function to call when data was received.
+     *  \return     Boolean indicating whether the delegate table had room left.
+     *
+     *  The view passed to the function is taken during the interrupt pass,
+     *  its size is the received byte count. Data consumed through the view
+     *  is gone for the following callbacks as well.
      */
-    void addCallbackFunction(void (AbstractSocket::*signal)(void), void (*callbackFunction)(void));
+    bool addReceiveCallbackFunction(void (*callbackFunction)(AbstractSocket&, RxView&));
 
     /**
-     *  \fn         addCallback(void (AbstractSocket::*signal)(void), Callback& callback)
-     *  \brief      Adds the callback instance to a specified signal of the socket.
-     *  \param[in]  singal passes the signal to add the callback function to.
-     *  \param[in]  callback passes the instance to call when signal is emitted.
+     *  \fn         addReceiveCallback(ReceiveCallback& callback)
+     *  \brief      Adds a callback instance receiving the socket and its received data.
+     *  \param[in]  callback passes the instance to call when data was received.
+     *  \return     Boolean indicating whether the delegate table had room left.
      */
-    void addCallback(void (AbstractSocket::*signal)(void), Callback& callback);
+    bool addReceiveCallback(ReceiveCallback& callback);
 
 public: /* SIGNALS */
     /**
      *  \fn     eventOccured(void)
      *  \brief  This signal is issued when socket is connected.
      *  \note   The signal needs callbacks to work properly.
+     *  \return The Sn_IR flags read before any callback ran.
+     *
+     *  Sn_IR is read together with Sn_SR and the read flags are cleared right
+     *  away, before the signals of the individual flags are emitted.
      */
-    void eventOccured(void);
+    unsigned char eventOccured(void);
 
     /**
      *  \fn     connected(void)
      *  \brief  This signal is issued when socket is connected.
      *  \note   The signal needs callbacks to work properly. 
+     *
+     *  The flags read by eventOccured() are dispatched by their bit index to
+     *  connected(), disconnected(), receivedMessage(), timedOut() and
+     *  messageSent(), each firing the delegates of its SocketEvent.
      */
     void connected(void);
 
@@ -132,6 +418,8 @@ public: /* SIGNALS */
      *  \fn     receivedMessage(void)
      *  \brief  This signal is issued when socket received a message.
      *  \note   The signal needs callbacks to work properly. 
+     *
+     *  Sn_RX_RSR is only read if receive callbacks carrying data are added.
      */
     void receivedMessage(void);
 
@@ -145,17 +433,35 @@ public: /* SIGNALS */
     /**
      *  \fn     messageSent(void) 
      *  \brief  This signal is issued when message is sent.
-     *  \note   The signal needs callbacks to work properly. 
+     *
+     *  The SEND in flight is completed before, which issues the SEND of data
+     *  buffered while the previous one was in flight.
      */
     void messageSent(void);
 
 protected:
     /**
-     *  \fn         enableInterrupts(const unsigned char& interruptMask = 0x1f) 
-     *  \brief      Enables the specified socket interrupts.
-     *  \param[in]  interruptMask passes the interrupt mask to enable. 
+     *  \fn     statusUpdated(void)
+     *  \brief  Is called whenever a snapshot changes the cached Sn_SR.
+     *
+     *  Every read of Sn_SR goes through takeSnapshot(), so socket types can
+     *  track their state without further SPI traffic.
      */
-    void enableInterrupts(const unsigned char& interruptMask = 0x1f);
+    virtual void statusUpdated(void) {}
+
+    /**
+     *  \fn         setMode(const unsigned char& mode)
+     *  \brief      Writes Sn_MR unless the shadow copy already holds the value.
+     *  \param[in]  mode passes the protocol and option bits to set.
+     */
+    void setMode(const unsigned char& mode);
+
+    /**
+     *  \fn     invalidateShadowRegisters(void)
+     *  \brief  Forces the next writes of the MCU-owned registers to reach the chip.
+     *  \note   Needs to be called whenever the socket is bound to a hardware socket.
+     */
+    void invalidateShadowRegisters(void);
 
     /**
      *  \fn         writeControlRegister()
@@ -166,7 +472,7 @@ protected:
      */
     void writeControlRegister(const uint16_t& addressWord,
                               const unsigned char* dataByteArray,
-                              const uint8_t& dataByteCount);
+                              const uint16_t& dataByteCount);
 
     /**
      * 	\fn			readControlRegister()
@@ -178,7 +484,115 @@ protected:
      */
     void readControlRegister(const uint16_t& addressWord,
                              unsigned char* dataByteArray,
-                             const uint8_t& dataByteCount);
+                             const uint16_t& dataByteCount);
+
+    /**
+     *  \fn         writeSocketRegister(const unsigned char* dataByteArray)
+     *  \brief      Writes the socket register passed as template argument.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[in]  dataByteArray passes the data of the register's width.
+     */
+    template<typename TargetRegister>
+    void writeSocketRegister(const unsigned char* dataByteArray)
+    {
+        static_assert(RegisterBlock::Socket == TargetRegister::block, "Register is no socket register.");
+        writeControlRegister(TargetRegister::address, dataByteArray, TargetRegister::width);
+    }
+
+    /**
+     *  \fn         readSocketRegister(unsigned char* dataByteArray)
+     *  \brief      Reads the socket register passed as template argument.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[out] dataByteArray passes the array of the register's width to read into.
+     */
+    template<typename TargetRegister>
+    void readSocketRegister(unsigned char* dataByteArray)
+    {
+        static_assert(RegisterBlock::Socket == TargetRegister::block, "Register is no socket register.");
+        readControlRegister(TargetRegister::address, dataByteArray, TargetRegister::width);
+    }
+
+    /**
+     *  \fn         writeSocketByte(const unsigned char& value)
+     *  \brief      Writes a single byte socket register.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[in]  value passes the value to write.
+     */
+    template<typename TargetRegister>
+    void writeSocketByte(const unsigned char& value)
+    {
+        static_assert(1 == TargetRegister::width, "Register is no byte register.");
+        writeSocketRegister<TargetRegister>(&value);
+    }
+
+    /**
+     *  \fn         readSocketByte(void)
+     *  \brief      Reads a single byte socket register.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \return     The register's value.
+     */
+    template<typename TargetRegister>
+    unsigned char readSocketByte(void)
+    {
+        static_assert(1 == TargetRegister::width, "Register is no byte register.");
+        unsigned char value = 0x00;
+        readSocketRegister<TargetRegister>(&value);
+        return value;
+    }
+
+    /**
+     *  \fn         writeSocketWord(const uint16_t& value)
+     *  \brief      Writes a two byte socket register in network byte order.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[in]  value passes the value to write.
+     */
+    template<typename TargetRegister>
+    void writeSocketWord(const uint16_t& value)
+    {
+        static_assert(2 == TargetRegister::width, "Register is no word register.");
+        const unsigned char valueInBytes[2] = {static_cast<unsigned char>((value >> 8) & 0xff),
+                                               static_cast<unsigned char>(value & 0xff)};
+        writeSocketRegister<TargetRegister>(valueInBytes);
+    }
+
+    /**
+     *  \fn         readSocketWord(void)
+     *  \brief      Reads a two byte socket register in network byte order.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \return     The register's value.
+     */
+    template<typename TargetRegister>
+    uint16_t readSocketWord(void)
+    {
+        static_assert(2 == TargetRegister::width, "Register is no word register.");
+        unsigned char valueInBytes[2] = {};
+        readSocketRegister<TargetRegister>(valueInBytes);
+        return (static_cast<uint16_t>(valueInBytes[0]) << 8) + valueInBytes[1];
+    }
+
+    /**
+     *  \fn         readStableSocketWord(uint16_t value)
+     *  \brief      Re-reads a two byte socket register until two consecutive reads match.
+     *  \tparam     TargetRegister passes the register description of the register map.
+     *  \param[in]  value passes the value of the previous read.
+     *  \return     The register's stable value.
+     *
+     *  The chip may update Sn_TX_FSR and Sn_RX_RSR between reading their
+     *  high and low byte, so the datasheet asks for a matching second read.
+     */
+    template<typename TargetRegister>
+    uint16_t readStableSocketWord(uint16_t value)
+    {
+        uint16_t nextValue = readSocketWord<TargetRegister>();
+
+        while (nextValue != value)
+        {
+            value = nextValue;
+            nextValue = readSocketWord<TargetRegister>();
+        }
+
+        return value;
+    }
 
     /**
      *  \var    _chipInterface
@@ -193,13 +607,127 @@ protected:
      */
     uint8_t _index;
 
+    /**
+     *  \var    _socketBlockBits
+     *  \brief  The socket's index in the block select bits of the control byte.
+     */
+    unsigned char _socketBlockBits = 0x00;
+
+    /**
+     *  \var    _txWritePointer
+     *  \brief  Shadow copy of Sn_TX_WR, which is only written by the MCU.
+     */
+    uint16_t _txWritePointer = 0;
+
+    /**
+     *  \var    _rxReadPointer
+     *  \brief  Shadow copy of Sn_RX_RD, which is only written by the MCU.
+     */
+    uint16_t _rxReadPointer = 0;
+
+    /**
+     *  \var    _txFreeSize
+     *  \brief  Sn_TX_FSR of the last snapshot less the bytes written since, for pollReadiness().
+     */
+    uint16_t _txFreeSize = 0;
+
+    /**
+     *  \var    _rxReceivedSize
+     *  \brief  Sn_RX_RSR of the last snapshot less the bytes released since, for pollReadiness().
+     */
+    uint16_t _rxReceivedSize = 0;
+
+    /**
+     *  \var    _localPort
+     *  \brief  Shadow copy of Sn_PORT.
+     */
+    uint16_t _localPort = 0;
+
+    /**
+     *  \var    _mode
+     *  \brief  Shadow copy of Sn_MR.
+     */
+    unsigned char _mode = 0x00;
+
+    /**
+     *  \var    _interruptMask
+     *  \brief  Shadow copy of Sn_IMR.
+     */
+    unsigned char _interruptMask = 0x1f;
+
+    /**
+     *  \var    _status
+     *  \brief  Sn_SR as read by the last interrupt pass or poll.
+     */
+    unsigned char _status = SocketStatus::Closed;
+
+    /**
+     *  \var    _interruptFlags
+     *  \brief  Sn_IR as read by the last interrupt pass.
+     */
+    unsigned char _interruptFlags = 0x00;
+
+    /**
+     *  \var    _pendingEvents
+     *  \brief  Sn_IR events collected until takePendingEvents() is called.
+     */
+    unsigned char _pendingEvents = 0x00;
+
+    /**
+     *  \var    _shadowValidMask
+     *  \brief  Marks the shadow copies that match the chip's registers.
+     *
+     *  The buffer pointers are read back by loadBufferPointers() after OPEN,
+     *  the only command that changes them besides the MCU, or bind(). A shadow
+     *  copy only becomes valid by a write reaching a bound chip, so values
+     *  set before bind() are written once the socket is bound.
+     */
+    uint8_t _shadowValidMask = 0x00;
+
+    static constexpr uint8_t _shadowModeBit = 0x01;
+    static constexpr uint8_t _shadowPortBit = 0x02;
+    static constexpr uint8_t _shadowPointerBit = 0x04;
+    static constexpr uint8_t _shadowInterruptMaskBit = 0x08;
+
 private:
+    /**
+     *  \fn         canTransmit(const unsigned char& status)
+     *  \brief      Checks whether SEND is accepted in the passed socket status.
+     *  \param[in]  status passes the Sn_SR value to check.
+     *  \return     Boolean indicating whether data can be transmitted.
+     */
+    static bool canTransmit(const unsigned char& status);
+
     /**
      *  \fn     sendBuffer(void)
      *  \brief  Sends transmits all the data in the socket's SnTX buffer.
      */
     void sendBuffer(void);
 
+    /**
+     *  \fn         refreshSendState(const uint8_t& parts = 0)
+     *  \brief      Takes a snapshot including Sn_IR and Sn_SR and completes a finished SEND.
+     *  \param[in]  parts passes further SnapshotPart bits to read.
+     *  \return     The snapshot, its TX free size reduced by the bytes not sent yet.
+     *
+     *  A SEND_OK acknowledged here is recorded as pending event, completes
+     *  the SEND and emits messageSent(), as it would have in the interrupt path.
+     */
+    SocketSnapshot refreshSendState(const uint8_t& parts = 0);
+
+    /**
+     *  \fn     completeSend(void)
+     *  \brief  Ends the SEND in flight and issues the SEND deferred meanwhile.
+     *  \note   SEND_OK has to be cleared in Sn_IR by the caller beforehand.
+     */
+    void completeSend(void);
+
+    /**
+     *  \fn     waitForDeferredSend(void)
+     *  \brief  Polls for SEND_OK until a deferred SEND was issued or the connection is lost.
+     */
+    void waitForDeferredSend(void);
+
     /**
      *  \fn         writeToBuffer(const unsigned char* data, const uint16_t length) 
      *  \brief      Writes to the sockets SnTX buffer register.
@@ -209,24 +737,42 @@ private:
      */
     void writeBufferRegister(const uint16_t& addressRegister,
                              const unsigned char* data,
-                             const uint8_t& length);
+                             const uint16_t& length);
 
+    /**
+     *  \fn         readRXBufferRegister()
+     *  \brief      Reads from the sockets SnRX buffer register.
+     *  \param[in]  addressRegister passes the buffers register to start reading.
+     *  \param[out] data passes the array to copy the buffer content into.
+     *  \param[in]  length passes the number of bytes to read.
+     */
     void readRXBufferRegister(const uint16_t& addressRegister,
                               unsigned char* data,
-                              const uint8_t& length);
+                              const uint16_t& length);
+
+    void setRXReadPointer(const uint16_t position);
 
     /**
-     *  \fn     readTXBufferPointer(void)
-     *  \brief  Reads the pointer on the data in the SNTxBuffer.
-     *  \return 16 bit pointer to the target position.
+     *  \fn     loadBufferPointers(void)
+     *  \brief  Reads Sn_TX_WR and Sn_RX_RD unless their shadow copies are valid.
+     *
+     *  Every path using the cached pointers calls it first, so pointers
+     *  invalidated by bind() are read back before the buffers are accessed.
      */
-    uint16_t getTXWritePointer(void);
-
-    uint16_t getRXReadPointer(void);
+    void loadBufferPointers(void);
 
-    uint16_t getRXWritePointer(void);
+    /**
+     *  \fn         releaseRXBuffer(const uint16_t& length)
+     *  \brief      Advances Sn_RX_RD by the passed length and issues RECV.
+     *  \param[in]  length passes the number of bytes to release.
+     */
+    void releaseRXBuffer(const uint16_t& length);
 
-    void setRXReadPointer(const uint16_t position);
+    /**
+     *  \var    _readChunkSize
+     *  \brief  Number of bytes fetched per SPI frame while reading a record.
+     */
+    static constexpr uint8_t _readChunkSize = 16;
 
     /**
      *  \fn         setTXWritePointer(const uint16_t& length)
@@ -235,11 +781,130 @@ private:
      */
     void setTXWritePointer(const uint16_t& position);
 
-    Vector<void (*)(void)> _eventOccuredCallbackFunctionList;
-    Vector<Callback> _eventOccuredCallbackInstanceList;
+    /**
+     *  \fn         bufferData(const uint8_t* data, const uint16_t& length)
+     *  \brief      Appends data to the TX buffer, sending only when it runs full.
+     *  \param[in]  data passes the data to append.
+     *  \param[in]  length passes the number of bytes to append.
+     *  \return     The number of bytes appended, less if the connection was lost.
+     */
+    uint16_t bufferData(const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \fn     commitData(void)
+     *  \brief  Ends a sequence of bufferData() calls like a send would.
+     *
+     *  The data is sent unless the socket's coalescing holds it back, and a
+     *  SEND deferred by one in flight is waited for.
+     */
+    void commitData(void);
+
+    /**
+     *  \fn         appendToTXBuffer(const uint8_t* data, const uint16_t& length)
+     *  \brief      Writes to the TX buffer at the cached Sn_TX_WR without sending.
+     *  \param[in]  data passes the data to append.
+     *  \param[in]  length passes the number of bytes to append.
+     */
+    void appendToTXBuffer(const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \var    _txCoalescingThreshold
+     *  \brief  Number of pending bytes issuing SEND, zero disables coalescing.
+     */
+    uint16_t _txCoalescingThreshold = 0;
+
+    /**
+     *  \var    _txCoalescingTickLimit
+     *  \brief  Number of ticks pending data may wait, zero disables the timer.
+     */
+    uint16_t _txCoalescingTickLimit = 0;
+
+    /**
+     *  \var    _unsentTXLength
+     *  \brief  Bytes appended to the TX buffer but not covered by SEND yet.
+     */
+    uint16_t _unsentTXLength = 0;
+
+    /**
+     *  \var    _unsentTXTicks
+     *  \brief  Ticks elapsed since the first pending write.
+     */
+    uint16_t _unsentTXTicks = 0;
+
+    /**
+     *  \var    _isSendInProgress
+     *  \brief  Indicates a SEND whose SEND_OK hasn't been seen yet.
+     */
+    bool _isSendInProgress = false;
+
+    /**
+     *  \var    _isSendDeferred
+     *  \brief  Indicates buffered data waiting for SEND_OK to be sent.
+     */
+    bool _isSendDeferred = false;
+
+    /**
+     *  \var    _pendingTXWritePointer
+     *  \brief  The TX write pointer written by a queued asynchronous send.
+     */
+    unsigned char _pendingTXWritePointer[2] = {};
+
+    /**
+     *  \fn         updateStatus(const unsigned char& status)
+     *  \brief      Caches the passed Sn_SR and calls statusUpdated() if it changed.
+     *  \param[in]  status passes the Sn_SR value read from the chip.
+     */
+    void updateStatus(const unsigned char& status);
+
+    /**
+     *  \fn         takeReadiness(unsigned char& interruptFlags)
+     *  \brief      Reads and clears Sn_IR without emitting signals.
+     *  \param[out] interruptFlags returns the Sn_IR flags that were read.
+     *  \return     The Connected, Closed and TimedOut edges reported by Sn_IR.
+     *
+     *  A full snapshot refreshes the state getReadinessLevel() derives from,
+     *  and the read flags are cleared. A SEND_OK completes the SEND in flight
+     *  like in the interrupt path.
+     */
+    uint8_t takeReadiness(unsigned char& interruptFlags);
+
+    /**
+     *  \fn     getReadinessLevel(void) const
+     *  \brief  Derives the readiness from the cached socket state without SPI traffic.
+     *  \return Readable while received data is buffered, Writable while the
+     *          socket can transmit and has free TX space, Closed while Sn_SR
+     *          is CLOSED or CLOSE_WAIT.
+     */
+    uint8_t getReadinessLevel(void) const;
+
+    /**
+     *  \fn         fireDelegates(const SocketEvent& event)
+     *  \brief      Calls all delegates added to the passed event.
+     *  \param[in]  event passes the event that occurred.
+     */
+    void fireDelegates(const SocketEvent& event);
+
+    /**
+     *  \var    _socketEventCount
+     *  \brief  Number of events with a delegate table, the Sn_IR bits and 'Any'.
+     */
+    static constexpr uint8_t _socketEventCount = 6;
+
+    /**
+     *  \var    _eventDelegates
+     *  \brief  The delegate tables indexed by SocketEvent.
+     */
+    DelegateTable<W5500_SOCKET_DELEGATE_CAPACITY> _eventDelegates[_socketEventCount];
+
+    /**
+     *  \var    _receiveDelegates
+     *  \brief  The delegates getting the received data passed.
+     */
+    DelegateTable<W5500_SOCKET_DELEGATE_CAPACITY, AbstractSocket&, RxView&> _receiveDelegates;
 
-    Vector<void (*)(void)> _receivedMessageCallbackFunctionList;
-    Vector<Callback> _receivedMessageCallbackInstanceList;
+    friend class RxView;
+    friend class TxWriter;
+    friend class W5500;
 };
 
 #endif //__ABSTRACT_SOCKET_HPP__
\ No newline at end of file
@@ -0,0 +1,36 @@
+/**
+ *  \file   async_operation.hpp
+ *  \brief  The file contains the state of the awaitable socket operations.
+ */
+
+#ifndef __ASYNC_OPERATION_HPP__
+#define __ASYNC_OPERATION_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \enum   AsyncResult
+ *  \brief  The outcome of a single attempt of an awaitable operation.
+ */
+enum class AsyncResult : uint8_t
+{
+    Pending,
+    Done,
+    Failed
+};
+
+/**
+ *  \struct AsyncState
+ *  \brief  The progress an awaitable operation keeps between its attempts.
+ *
+ *  A fresh state starts the operation. While the result is Pending,
+ *  'awaitedEvents' holds the Sn_IR events that may let the next attempt
+ *  progress.
+ */
+struct AsyncState
+{
+    uint16_t progress = 0;
+    unsigned char awaitedEvents = 0x00;
+};
+
+#endif //__ASYNC_OPERATION_HPP__
@@ -0,0 +1,133 @@
+/**
+ *  \file   rx_view.cpp
+ *  \brief  The file contains implementation for the RxView class.
+ */
+
+#include "rx_view.hpp"
+
+#include "abstract_socket.hpp"
+
+RxView::RxView(AbstractSocket* socket, const uint16_t& size)
+    : _socket(socket)
+    , _size(size)
+{}
+
+uint16_t RxView::size(void) const
+{
+    return _size;
+}
+
+bool RxView::isEmpty(void) const
+{
+    return 0 == _size;
+}
+
+uint8_t RxView::at(const uint16_t& offset) const
+{
+    uint8_t value = 0x00;
+    read(offset, &value, 1);
+    return value;
+}
+
+uint16_t RxView::read(const uint16_t& offset, uint8_t* destination, const uint16_t& length) const
+{
+    if (offset >= _size)
+    {
+        return 0;
+    }
+
+    uint16_t readLength = _size - offset;
+
+    if (readLength > length)
+    {
+        readLength = length;
+    }
+
+    if (readLength)
+    {
+        _socket->loadBufferPointers();
+        _socket->readRXBufferRegister(_socket->_rxReadPointer + offset, destination, readLength);
+    }
+
+    return readLength;
+}
+
+uint16_t RxView::find(const uint8_t& value, const uint16_t& from) const
+{
+    uint8_t chunk[_scanChunkSize];
+    uint16_t offset = from;
+
+    while (offset < _size)
+    {
+        const uint16_t chunkLength = read(offset, chunk, _scanChunkSize);
+
+        for (uint16_t i = 0; i < chunkLength; i++)
+        {
+            if (value == chunk[i])
+            {
+                return offset + i;
+            }
+        }
+
+        offset += chunkLength;
+    }
+
+    return npos;
+}
+
+uint16_t RxView::find(const uint8_t* pattern, const uint16_t& patternLength, const uint16_t& from) const
+{
+    if (0 == patternLength)
+    {
+        return from <= _size ? from : npos;
+    }
+
+    uint8_t chunk[_scanChunkSize];
+    uint16_t candidate = find(pattern[0], from);
+
+    while (npos != candidate && static_cast<uint32_t>(candidate) + patternLength <= _size)
+    {
+        bool isMatch = true;
+
+        for (uint16_t compared = 1; isMatch && compared < patternLength;)
+        {
+            uint16_t chunkLength = patternLength - compared;
+
+            if (chunkLength > _scanChunkSize)
+            {
+                chunkLength = _scanChunkSize;
+            }
+
+            chunkLength = read(candidate + compared, chunk, chunkLength);
+
+            for (uint16_t i = 0; isMatch && i < chunkLength; i++)
+            {
+                isMatch = pattern[compared + i] == chunk[i];
+            }
+
+            compared += chunkLength;
+        }
+
+        if (isMatch)
+        {
+            return candidate;
+        }
+
+        candidate = find(pattern[0], candidate + 1);
+    }
+
+    return npos;
+}
+
+uint16_t RxView::consume(const uint16_t& length)
+{
+    const uint16_t consumedLength = length < _size ? length : _size;
+
+    if (consumedLength)
+    {
+        _socket->releaseRXBuffer(consumedLength);
+        _size -= consumedLength;
+    }
+
+    return consumedLength;
+}
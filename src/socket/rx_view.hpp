@@ -0,0 +1,122 @@
+/**
+ *  \file   rx_view.hpp
+ *  \brief  The file contains declaration for the RxView class.
+ */
+
+#ifndef __RX_VIEW_HPP__
+#define __RX_VIEW_HPP__
+
+#include <stdint.h>
+
+class AbstractSocket;
+
+/**
+ *  \class  RxView
+ *  \brief  The class represents the unread region of a socket's RX buffer.
+ *
+ *  The view covers the bytes between Sn_RX_RD and Sn_RX_WR at the time it
+ *  was taken. Reads go straight to the W5500 memory, so a parser can look
+ *  at length prefixes or delimiters without copying the whole payload into
+ *  SRAM. Offsets are relative to the first unread byte. The view is only
+ *  valid as long as no other receive method is called on its socket.
+ */
+class RxView
+{
+public:
+    /**
+     *  \var    npos
+     *  \brief  The offset returned by find() if nothing was found.
+     */
+    static constexpr uint16_t npos = 0xffff;
+
+    /**
+     *  \fn         RxView(AbstractSocket* socket, const uint16_t& size)
+     *  \brief      The constructor initializes an instance of type 'RxView'.
+     *  \param[in]  socket passes the socket owning the RX buffer.
+     *  \param[in]  size passes the number of unread bytes.
+     */
+    RxView(AbstractSocket* socket, const uint16_t& size);
+
+    /**
+     *  \fn       size(void) const
+     *  \brief    Returns the number of bytes covered by the view.
+     *  \return   The length of the view.
+     */
+    uint16_t size(void) const;
+
+    /**
+     *  \fn       isEmpty(void) const
+     *  \brief    Checks whether the view covers no data.
+     *  \return   Boolean indicating an empty view.
+     */
+    bool isEmpty(void) const;
+
+    /**
+     *  \fn         at(const uint16_t& offset) const
+     *  \brief      Reads a single byte of the view.
+     *  \param[in]  offset passes the position of the byte.
+     *  \return     The byte at the offset, zero if the offset is out of range.
+     */
+    uint8_t at(const uint16_t& offset) const;
+
+    /**
+     *  \fn         read(const uint16_t& offset, uint8_t* destination, const uint16_t& length) const
+     *  \brief      Copies a range of the view without consuming it.
+     *  \param[in]  offset passes the position of the first byte.
+     *  \param[out] destination passes the buffer to copy the data into.
+     *  \param[in]  length passes the number of bytes to copy.
+     *  \return     The number of bytes copied, clamped to the end of the view.
+     */
+    uint16_t read(const uint16_t& offset, uint8_t* destination, const uint16_t& length) const;
+
+    /**
+     *  \fn         find(const uint8_t& value, const uint16_t& from = 0) const
+     *  \brief      Searches the view for a byte.
+     *  \param[in]  value passes the byte to search for.
+     *  \param[in]  from passes the offset to start searching at.
+     *  \return     The offset of the first match or npos.
+     */
+    uint16_t find(const uint8_t& value, const uint16_t& from = 0) const;
+
+    /**
+     *  \fn         find(const uint8_t* pattern, const uint16_t& patternLength, const uint16_t& from = 0) const
+     *  \brief      Searches the view for a byte sequence like "\r\n\r\n".
+     *  \param[in]  pattern passes the sequence to search for.
+     *  \param[in]  patternLength passes the length of the sequence.
+     *  \param[in]  from passes the offset to start searching at.
+     *  \return     The offset of the first byte of the first match or npos.
+     */
+    uint16_t find(const uint8_t* pattern, const uint16_t& patternLength, const uint16_t& from = 0) const;
+
+    /**
+     *  \fn         consume(const uint16_t& length)
+     *  \brief      Releases the passed number of bytes from the front of the view.
+     *  \param[in]  length passes the number of bytes to release.
+     *  \return     The number of bytes released.
+     *
+     *  Sn_RX_RD is advanced and RECV is issued once. Offsets of the view are
+     *  shifted accordingly.
+     */
+    uint16_t consume(const uint16_t& length);
+
+private:
+    /**
+     *  \var    _scanChunkSize
+     *  \brief  Number of bytes fetched per SPI frame while searching.
+     */
+    static constexpr uint8_t _scanChunkSize = 16;
+
+    /**
+     *  \var    _socket
+     *  \brief  The socket owning the RX buffer.
+     */
+    AbstractSocket* _socket;
+
+    /**
+     *  \var    _size
+     *  \brief  The number of bytes covered by the view.
+     */
+    uint16_t _size;
+};
+
+#endif //__RX_VIEW_HPP__
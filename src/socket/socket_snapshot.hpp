@@ -0,0 +1,44 @@
+/**
+ *  \file   socket_snapshot.hpp
+ *  \brief  The file contains declaration for the SocketSnapshot struct.
+ */
+
+#ifndef __SOCKET_SNAPSHOT_HPP__
+#define __SOCKET_SNAPSHOT_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \namespace  SnapshotPart
+ *  \brief      The register groups a snapshot can be taken of.
+ *
+ *  Sn_IR and Sn_SR are contiguous, as are Sn_TX_FSR up to Sn_RX_WR. Each
+ *  group is read in a single frame, adjacent TX and RX state together.
+ */
+namespace SnapshotPart
+{
+constexpr uint8_t Status = 0x01;
+constexpr uint8_t TXState = 0x02;
+constexpr uint8_t RXState = 0x04;
+constexpr uint8_t All = Status | TXState | RXState;
+} // namespace SnapshotPart
+
+/**
+ *  \struct SocketSnapshot
+ *  \brief  The state of a socket's buffers and status at one point in time.
+ *
+ *  Fields of parts not taken are zero.
+ */
+struct SocketSnapshot
+{
+    unsigned char interruptFlags;
+    unsigned char status;
+    uint16_t txFreeSize;
+    uint16_t txReadPointer;
+    uint16_t txWritePointer;
+    uint16_t rxReceivedSize;
+    uint16_t rxReadPointer;
+    uint16_t rxWritePointer;
+};
+
+#endif //__SOCKET_SNAPSHOT_HPP__
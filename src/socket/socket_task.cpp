@@ -0,0 +1,50 @@
+/**
+ *  \file   socket_task.cpp
+ *  \brief  The file contains implementation for the SocketTask class.
+ */
+
+#include "socket_task.hpp"
+
+SocketTask::SocketTask(TcpSocket& socket)
+    : _socket(socket)
+{
+}
+
+bool SocketTask::service(void)
+{
+    if (_isFinished)
+    {
+        return false;
+    }
+
+    if (_asyncState.awaitedEvents)
+    {
+        if (!_socket.takePendingEvents(_asyncState.awaitedEvents))
+        {
+            return true;
+        }
+
+        _asyncState.awaitedEvents = 0x00;
+    }
+
+    run();
+    return !_isFinished;
+}
+
+void SocketTask::restart(void)
+{
+    _asyncState = AsyncState();
+    _asyncResult = AsyncResult::Done;
+    _resumePoint = 0;
+    _isFinished = false;
+}
+
+bool SocketTask::isFinished(void) const
+{
+    return _isFinished;
+}
+
+bool SocketTask::isFailed(void) const
+{
+    return AsyncResult::Failed == _asyncResult;
+}
@@ -0,0 +1,135 @@
+/**
+ *  \file   socket_task.hpp
+ *  \brief  The file contains declaration for the SocketTask class.
+ *
+ *  A SocketTask is a stackless coroutine in the style of protothreads. Its
+ *  body is written as straight line code between W5500_TASK_BEGIN() and
+ *  W5500_TASK_END() and suspends at every W5500_TASK_AWAIT() whose
+ *  operation is still pending. Locals don't survive a suspension, so the
+ *  state of a session has to live in members of the derived task. Only one
+ *  W5500_TASK_AWAIT() or W5500_TASK_YIELD() may be written per line.
+ */
+
+#ifndef __SOCKET_TASK_HPP__
+#define __SOCKET_TASK_HPP__
+
+#include <stdint.h>
+
+#include "async_operation.hpp"
+#include "tcp_socket.hpp"
+
+#define W5500_TASK_BEGIN()   \
+    switch (_resumePoint)    \
+    {                        \
+    case 0:
+
+#define W5500_TASK_AWAIT(operation)                               \
+    _asyncState = AsyncState();                                   \
+    _resumePoint = __LINE__;                                      \
+    [[fallthrough]];                                              \
+    case __LINE__:                                                \
+        if (AsyncResult::Pending == (_asyncResult = (operation))) \
+        {                                                         \
+            return;                                               \
+        }
+
+#define W5500_TASK_YIELD()       \
+    _resumePoint = __LINE__;     \
+    return;                      \
+    case __LINE__:
+
+#define W5500_TASK_EXIT() \
+    _isFinished = true;   \
+    return
+
+#define W5500_TASK_END() \
+    }                    \
+    _isFinished = true
+
+/**
+ *  \class  SocketTask
+ *  \brief  The base class of resumable tasks driving a TCP socket.
+ *
+ *  A task awaiting an operation is parked on the Sn_IR events that operation
+ *  needs. service() skips parked tasks until W5500::poll(),
+ *  W5500::handleInterrupt() or W5500::pollReadiness() recorded one of those
+ *  events, so many sessions share the main loop without extra SPI traffic.
+ *  A task takes the pending events of its socket, so only one task should
+ *  drive a socket at a time.
+ */
+class SocketTask
+{
+public:
+    /**
+     *  \fn             SocketTask(TcpSocket& socket)
+     *  \brief          The constructor initializes an instance of type 'SocketTask'.
+     *  \param[inout]   socket passes the socket driven by the task.
+     */
+    explicit SocketTask(TcpSocket& socket);
+
+    /**
+     *  \fn     service(void)
+     *  \brief  Resumes the task if it isn't parked, called from the main loop.
+     *  \return Boolean indicating whether the task is still running.
+     */
+    bool service(void);
+
+    /**
+     *  \fn     restart(void)
+     *  \brief  Lets the next service() run the task from its beginning.
+     */
+    void restart(void);
+
+    /**
+     *  \fn     isFinished(void) const
+     *  \brief  Checks whether the task ran to its end or exited.
+     *  \return Boolean indicating a finished task.
+     */
+    bool isFinished(void) const;
+
+protected:
+    /**
+     *  \fn     run(void)
+     *  \brief  The body of the task, enclosed by W5500_TASK_BEGIN() and W5500_TASK_END().
+     */
+    virtual void run(void) = 0;
+
+    /**
+     *  \fn     isFailed(void) const
+     *  \brief  Checks whether the last awaited operation failed.
+     *  \return Boolean indicating a failed operation.
+     */
+    bool isFailed(void) const;
+
+    /**
+     *  \var    _socket
+     *  \brief  The socket driven by the task.
+     */
+    TcpSocket& _socket;
+
+    /**
+     *  \var    _asyncState
+     *  \brief  The progress of the awaited operation.
+     */
+    AsyncState _asyncState;
+
+    /**
+     *  \var    _asyncResult
+     *  \brief  The result of the last awaited operation.
+     */
+    AsyncResult _asyncResult = AsyncResult::Done;
+
+    /**
+     *  \var    _resumePoint
+     *  \brief  The line the task continues at, zero for its beginning.
+     */
+    uint16_t _resumePoint = 0;
+
+    /**
+     *  \var    _isFinished
+     *  \brief  Set once the task ran to its end or exited.
+     */
+    bool _isFinished = false;
+};
+
+#endif //__SOCKET_TASK_HPP__
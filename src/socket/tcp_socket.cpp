@@ -6,6 +6,36 @@
 #include "tcp_socket.hpp"
 
 #include "../chip/wiznet_w5500.hpp"
+#include "../trace/trace.hpp"
+
+namespace
+{
+/* Condenses the Sn_SR values of a TCP socket into its connection state. */
+TcpState toTcpState(const unsigned char& status)
+{
+    switch (status)
+    {
+    case SocketStatus::Initialized:
+        return TcpState::Opened;
+    case SocketStatus::Listening:
+        return TcpState::Listening;
+    case SocketStatus::SynSent:
+    case SocketStatus::SynReceived:
+        return TcpState::Connecting;
+    case SocketStatus::Established:
+        return TcpState::Established;
+    case SocketStatus::CloseWait:
+        return TcpState::PeerClosed;
+    case SocketStatus::FinWait:
+    case SocketStatus::Closing:
+    case SocketStatus::TimeWait:
+    case SocketStatus::LastAck:
+        return TcpState::Closing;
+    default:
+        return TcpState::Closed;
+    }
+}
+} // namespace
 
 TcpSocket::TcpSocket(void)
     : AbstractSocket()
@@ -14,66 +44,247 @@ TcpSocket::TcpSocket(void)
 
 void TcpSocket::listen(void)
 {
-    constexpr unsigned char listenBitmask = 0x02;
-    constexpr uint16_t SnCRRegisterAddress = 0x0001;
-    writeControlRegister(SnCRRegisterAddress, &listenBitmask, 1);
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Listen);
+    refreshStatus();
 }
 
-bool TcpSocket::isOpen(void)
+void TcpSocket::connect(const HostAddress& address, const uint16_t& port)
 {
-    constexpr uint16_t SnSRRegisterAddress = 0x0003;
-    unsigned char socketStatus;
-    readControlRegister(SnSRRegisterAddress, &socketStatus, 1);
+    writeSocketRegister<SocketRegister::DestinationIPAddress>(address.toArray());
+    writeSocketWord<SocketRegister::DestinationPort>(port);
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Connect);
+    refreshStatus();
+}
 
-    const bool socketIsInitialized = socketStatus == 0x13;
+void TcpSocket::disconnect(void)
+{
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Disconnect);
+    refreshStatus();
+}
 
-    return socketIsInitialized || isListening() || isConnected();
+void TcpSocket::close(void)
+{
+    writeSocketByte<SocketRegister::Command>(SocketCommand::Close);
+    refreshStatus();
 }
 
-bool TcpSocket::isListening(void)
+TcpState TcpSocket::update(void)
 {
-    constexpr uint16_t SnSRRegisterAddress = 0x0003;
-    unsigned char socketStatus;
-    readControlRegister(SnSRRegisterAddress, &socketStatus, 1);
-    return socketStatus == 0x14;
+    refreshStatus();
+    return _state;
 }
 
-bool TcpSocket::isConnected(void)
+TcpState TcpSocket::getState(void) const
+{
+    return _state;
+}
+
+void TcpSocket::setConnectionTimeout(const uint16_t& tickLimit)
+{
+    _connectionTimeout = tickLimit;
+    _stateTicks = 0;
+}
+
+bool TcpSocket::addStateCallbackFunction(void (*callbackFunction)(TcpSocket&, const TcpState&))
+{
+    return _stateDelegates.append(callbackFunction);
+}
+
+void TcpSocket::tick(void)
+{
+    AbstractSocket::tick();
+
+    if (!_connectionTimeout || !hasDeadline() || ++_stateTicks < _connectionTimeout)
+    {
+        return;
+    }
+
+    /* The cached state may lag behind without interrupt handling, Sn_SR decides. */
+    refreshStatus();
+
+    if (!hasDeadline())
+    {
+        return;
+    }
+
+    close();
+    timedOut();
+}
+
+void TcpSocket::statusUpdated(void)
 {
-    constexpr uint16_t SnSRREgisterAddress = 0x0003;
-    unsigned char socketStatus;
-    readControlRegister(SnSRREgisterAddress, &socketStatus, 1);
-    return socketStatus == 0x17;
+    const TcpState state = toTcpState(_status);
+
+    if (state == _state)
+    {
+        return;
+    }
+
+    _state = state;
+    _stateTicks = 0;
+
+    W5500_TRACE_EVENT(TraceEvent::StateChange, _index, (static_cast<uint16_t>(_state) << 8) | _status);
+
+    _stateDelegates.fire(*this, _state);
 }
 
-void TcpSocket::waitForConnected(void)
+AsyncResult TcpSocket::connectAsync(AsyncState& state, const HostAddress& address, const uint16_t& port)
 {
-    if (isListening())
+    if (0 == state.progress)
     {
-        while (!isConnected())
+        if (TcpState::Closed == _state)
         {
-            ;
+            open();
         }
+
+        connect(address, port);
+        state.progress = 1;
+    }
+
+    return awaitConnection(state);
+}
+
+AsyncResult TcpSocket::acceptAsync(AsyncState& state)
+{
+    if (0 == state.progress)
+    {
+        if (TcpState::Closed == _state)
+        {
+            open();
+        }
+
+        if (TcpState::Opened == _state)
+        {
+            listen();
+        }
+
+        state.progress = 1;
+    }
+
+    return awaitConnection(state);
+}
+
+AsyncResult TcpSocket::readAsync(AsyncState& state, uint8_t* destination, const uint16_t& length)
+{
+    state.progress += recv(destination + state.progress, length - state.progress);
+
+    if (state.progress == length)
+    {
+        return AsyncResult::Done;
+    }
+
+    return awaitData(state, SocketInterrupt::Received);
+}
+
+AsyncResult TcpSocket::readLineAsync(AsyncState& state, char* destination, const uint16_t& capacity)
+{
+    state.progress = readLine(destination, capacity);
+
+    if (state.progress)
+    {
+        return AsyncResult::Done;
+    }
+
+    return awaitData(state, SocketInterrupt::Received);
+}
+
+AsyncResult TcpSocket::writeAsync(AsyncState& state, const uint8_t* data, const uint16_t& length)
+{
+    if (TcpState::Established == _state || TcpState::PeerClosed == _state)
+    {
+        state.progress += trySend(data + state.progress, length - state.progress);
+    }
+
+    if (state.progress == length)
+    {
+        return AsyncResult::Done;
+    }
+
+    return awaitData(state, SocketInterrupt::SendOk);
+}
+
+AsyncResult TcpSocket::awaitConnection(AsyncState& state)
+{
+    switch (_state)
+    {
+    case TcpState::Established:
+        return AsyncResult::Done;
+    case TcpState::Listening:
+    case TcpState::Connecting:
+        state.awaitedEvents = SocketInterrupt::Connected | SocketInterrupt::Disconnected | SocketInterrupt::TimedOut;
+        return AsyncResult::Pending;
+    default:
+        return AsyncResult::Failed;
     }
 }
 
+AsyncResult TcpSocket::awaitData(AsyncState& state, const unsigned char& interruptMask)
+{
+    /* After the peer closed, sends still complete and buffered data may still complete a record. */
+    const bool canProgress = TcpState::Established == _state
+                             || (TcpState::PeerClosed == _state
+                                 && (SocketInterrupt::SendOk == interruptMask || available()));
+
+    if (!canProgress)
+    {
+        return AsyncResult::Failed;
+    }
+
+    state.awaitedEvents = interruptMask | SocketInterrupt::Disconnected | SocketInterrupt::TimedOut;
+    return AsyncResult::Pending;
+}
+
+bool TcpSocket::hasDeadline(void) const
+{
+    return TcpState::Connecting == _state || TcpState::Closing == _state;
+}
+
+bool TcpSocket::isOpen(void)
+{
+    const unsigned char socketStatus = refreshStatus();
+
+    return socketStatus == SocketStatus::Initialized || socketStatus == SocketStatus::Listening
+           || socketStatus == SocketStatus::Established;
+}
+
+bool TcpSocket::isListening(void)
+{
+    return refreshStatus() == SocketStatus::Listening;
+}
+
+bool TcpSocket::isConnected(void)
+{
+    return refreshStatus() == SocketStatus::Established;
+}
+
 void TcpSocket::specifyType(void)
 {
-    constexpr uint16_t SnModeRegisterAddress = 0x0000;
     constexpr unsigned char socketMode = 0x01;
-    writeControlRegister(SnModeRegisterAddress, &socketMode, 1);
+    setMode(socketMode);
 }
 
-void TcpSocket::bind(W5500* chipInterface, const uint16_t& port)
+void TcpSocket::bind(W5500* chipInterface,
+                     const uint16_t& port,
+                     const uint8_t& txBufferSize,
+                     const uint8_t& rxBufferSize)
 {
     _chipInterface = chipInterface;
+    invalidateShadowRegisters();
 
     if (_chipInterface)
     {
-        _index = _chipInterface->registerSocket(this);
+        _index = _chipInterface->registerSocket(this, txBufferSize, rxBufferSize);
+
+        if (W5500::invalidSocketIndex == _index)
+        {
+            _chipInterface = nullptr;
+            return;
+        }
+
+        _socketBlockBits = getSocketBlockBits(_index);
     }
 
     specifyType();
     setLocalPort(port);
-    enableInterrupts();
+    setInterruptMask(_interruptMask);
 }
\ No newline at end of file
@@ -6,7 +6,24 @@
 #ifndef __TCP_SOCKET_HPP__
 #define __TCP_SOCKET_HPP__
 
+#include "../address/host_address.hpp"
 #include "abstract_socket.hpp"
+#include "async_operation.hpp"
+
+/**
+ *  \enum   TcpState
+ *  \brief  The connection states of a TCP socket, condensed from Sn_SR.
+ */
+enum class TcpState : uint8_t
+{
+    Closed,
+    Opened,
+    Listening,
+    Connecting,
+    Established,
+    PeerClosed,
+    Closing
+};
 
 /**
  *  \class  TcpSocket
@@ -22,12 +39,20 @@ public:
     TcpSocket(void);
 
     /**
-     *  \fn             bind(W5500* chipInterface, const uint16_t& port) override        
+     *  \fn             bind(W5500* chipInterface, const uint16_t& port, const uint8_t& txBufferSize, const uint8_t& rxBufferSize) override
      *  \brief          Binds the socket to a port of the passed chip.
      *  \param[inout]   chipInterface passes a pointer to the W5500 interface instance.
      *  \param[in]      port passes the 16 bit source port value.
+     *  \param[in]      txBufferSize passes the TX buffer size in KB.
+     *  \param[in]      rxBufferSize passes the RX buffer size in KB.
+     *
+     *  If the chip has no free socket or not enough buffer memory left, the
+     *  socket stays unbound.
      */
-    virtual void bind(W5500* chipInterface, const uint16_t& port) override;
+    virtual void bind(W5500* chipInterface,
+                      const uint16_t& port,
+                      const uint8_t& txBufferSize = 2,
+                      const uint8_t& rxBufferSize = 2) override;
 
     /**
      *  \fn     listen(void)
@@ -35,6 +60,120 @@ public:
      */
     void listen(void);
 
+    /**
+     *  \fn         connect(const HostAddress& address, const uint16_t& port)
+     *  \brief      Starts connecting to the passed peer without waiting for the handshake.
+     *  \param[in]  address passes the peer's IPv4 address.
+     *  \param[in]  port passes the peer's port.
+     */
+    void connect(const HostAddress& address, const uint16_t& port);
+
+    /**
+     *  \fn     disconnect(void)
+     *  \brief  Starts closing the connection gracefully.
+     */
+    void disconnect(void);
+
+    /**
+     *  \fn     close(void)
+     *  \brief  Closes the socket immediately.
+     */
+    void close(void);
+
+    /**
+     *  \fn     update(void)
+     *  \brief  Reads Sn_SR and reports a changed state, for use without interrupts.
+     *  \return The current connection state.
+     */
+    TcpState update(void);
+
+    /**
+     *  \fn     getState(void) const
+     *  \brief  Returns the state seen by the last interrupt, update or status read.
+     *  \return The cached connection state without SPI traffic.
+     */
+    TcpState getState(void) const;
+
+    /**
+     *  \fn         setConnectionTimeout(const uint16_t& tickLimit)
+     *  \brief      Limits how long a connection may stay connecting or closing.
+     *  \param[in]  tickLimit passes the number of tick() calls, zero disables the deadline.
+     *
+     *  When the deadline passes, the socket is closed and the TimedOut
+     *  delegates are fired. Listening and established sockets have no
+     *  deadline.
+     */
+    void setConnectionTimeout(const uint16_t& tickLimit);
+
+    /**
+     *  \fn         addStateCallbackFunction(void (*callbackFunction)(TcpSocket&, const TcpState&))
+     *  \brief      Adds a function called on every state transition.
+     *  \param[in]  callbackFunction passes the function receiving the socket and its new state.
+     *  \return     Boolean indicating whether the delegate table had room left.
+     */
+    bool addStateCallbackFunction(void (*callbackFunction)(TcpSocket&, const TcpState&));
+
+    /**
+     *  \fn             connectAsync(AsyncState& state, const HostAddress& address, const uint16_t& port)
+     *  \brief          Attempts to progress an awaitable connect.
+     *  \param[inout]   state passes the progress of the operation.
+     *  \param[in]      address passes the peer's IPv4 address.
+     *  \param[in]      port passes the peer's port.
+     *  \return         Done once established, Failed if the socket closed or timed out.
+     *
+     *  The first attempt opens a closed socket and issues CONNECT.
+     */
+    AsyncResult connectAsync(AsyncState& state, const HostAddress& address, const uint16_t& port);
+
+    /**
+     *  \fn             acceptAsync(AsyncState& state)
+     *  \brief          Attempts to progress an awaitable wait for an incoming connection.
+     *  \param[inout]   state passes the progress of the operation.
+     *  \return         Done once established, Failed if the socket closed or timed out.
+     *
+     *  The first attempt opens a closed socket and issues LISTEN.
+     */
+    AsyncResult acceptAsync(AsyncState& state);
+
+    /**
+     *  \fn             readAsync(AsyncState& state, uint8_t* destination, const uint16_t& length)
+     *  \brief          Attempts to progress an awaitable read of exactly length bytes.
+     *  \param[inout]   state passes the progress, which counts the bytes read so far.
+     *  \param[out]     destination passes the buffer to fill.
+     *  \param[in]      length passes the number of bytes to read.
+     *  \return         Done once all bytes arrived, Failed if the connection ended before.
+     */
+    AsyncResult readAsync(AsyncState& state, uint8_t* destination, const uint16_t& length);
+
+    /**
+     *  \fn             readLineAsync(AsyncState& state, char* destination, const uint16_t& capacity)
+     *  \brief          Attempts to progress an awaitable readLine().
+     *  \param[inout]   state passes the progress, which holds the consumed length when done.
+     *  \param[out]     destination passes the buffer for the line as a C string.
+     *  \param[in]      capacity passes the size of the buffer including the NUL.
+     *  \return         Done once a line was read, Failed if the connection ended before.
+     */
+    AsyncResult readLineAsync(AsyncState& state, char* destination, const uint16_t& capacity);
+
+    /**
+     *  \fn             writeAsync(AsyncState& state, const uint8_t* data, const uint16_t& length)
+     *  \brief          Attempts to progress an awaitable write.
+     *  \param[inout]   state passes the progress, which counts the bytes buffered so far.
+     *  \param[in]      data passes the data to send. It must stay valid until done.
+     *  \param[in]      length passes the number of bytes to send.
+     *  \return         Done once all bytes are in the TX buffer, Failed if the connection ended before.
+     */
+    AsyncResult writeAsync(AsyncState& state, const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \fn     tick(void) override
+     *  \brief  Advances the coalescing timer and the connection deadline.
+     *
+     *  Sn_SR is read before a deadline closes the socket, so a connection
+     *  established without its interrupt being handled is kept.
+     */
+    virtual void tick(void) override;
+
     /**
      *  \fn       isOpen(void)
      *  \brief    Checks whether the socket is open or not.
@@ -56,12 +195,12 @@ public:
      */
     bool isConnected(void);
 
+protected:
     /**
-     *  \fn     waitForConnected(void) 
-     *  \brief  Waits until a connection is established.
-     *  \note   Socket must be listening to work properly.  
+     *  \fn     statusUpdated(void) override
+     *  \brief  Derives the state from the cached Sn_SR and fires the state delegates on a change.
      */
-    void waitForConnected(void);
+    virtual void statusUpdated(void) override;
 
 private:
     /**
@@ -69,6 +208,58 @@ private:
      *  \brief  Specifies the socket type on the W5500 chip.
      */
     void specifyType(void);
+
+    /**
+     *  \fn     hasDeadline(void) const
+     *  \brief  Checks whether the current state is bounded by the connection timeout.
+     *  \return Boolean indicating a connecting or closing socket.
+     */
+    bool hasDeadline(void) const;
+
+    /**
+     *  \fn             awaitConnection(AsyncState& state)
+     *  \brief          Completes connectAsync() and acceptAsync() after their first attempt.
+     *  \param[inout]   state passes the progress of the operation.
+     *  \return         The result derived from the cached state.
+     */
+    AsyncResult awaitConnection(AsyncState& state);
+
+    /**
+     *  \fn             awaitData(AsyncState& state, const unsigned char& interruptMask)
+     *  \brief          Parks a transfer on the passed events unless the connection ended.
+     *  \param[inout]   state passes the progress of the operation.
+     *  \param[in]      interruptMask passes the Sn_IR event that lets the transfer progress.
+     *  \return         Pending while the transfer can still progress, Failed otherwise.
+     *
+     *  Once the peer closed, a send may still wait for SEND_OK, and a read
+     *  may still wait while received data is left in the RX buffer. A read
+     *  that consumed everything can't progress any further.
+     */
+    AsyncResult awaitData(AsyncState& state, const unsigned char& interruptMask);
+
+    /**
+     *  \var    _state
+     *  \brief  The connection state derived from the cached Sn_SR.
+     */
+    TcpState _state = TcpState::Closed;
+
+    /**
+     *  \var    _connectionTimeout
+     *  \brief  Number of ticks a connecting or closing state may last, zero disables the deadline.
+     */
+    uint16_t _connectionTimeout = 0;
+
+    /**
+     *  \var    _stateTicks
+     *  \brief  Number of ticks since the last state transition.
+     */
+    uint16_t _stateTicks = 0;
+
+    /**
+     *  \var    _stateDelegates
+     *  \brief  The functions called on state transitions.
+     */
+    DelegateTable<W5500_SOCKET_DELEGATE_CAPACITY, TcpSocket&, const TcpState&> _stateDelegates;
 };
 
 #endif //__TCP_SOCKET_HPP__
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+ *  \file   tx_segment.hpp
+ *  \brief  The file contains declaration for the TxSegment struct.
+ */
+
+#ifndef __TX_SEGMENT_HPP__
+#define __TX_SEGMENT_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \struct TxSegment
+ *  \brief  A piece of a message passed to a gather send.
+ *
+ *  The segments of a message may live in different places, e.g. a constant
+ *  header, a payload owned by the application and a trailer. They are copied
+ *  one after the other into the TX buffer and sent as a single message.
+ */
+struct TxSegment
+{
+    const uint8_t* data;
+    uint16_t length;
+};
+
+#endif //__TX_SEGMENT_HPP__
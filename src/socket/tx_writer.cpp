@@ -0,0 +1,290 @@
+/**
+ *  \file   tx_writer.cpp
+ *  \brief  The file contains implementation for the TxWriter class.
+ */
+
+#include "tx_writer.hpp"
+
+#include "abstract_socket.hpp"
+
+#include <limits.h>
+
+TxWriter::Hex TxWriter::hex(const uint32_t& value, const uint8_t& digitCount)
+{
+    return Hex{value, digitCount};
+}
+
+TxWriter::Fixed TxWriter::fixed(const int32_t& value, const uint8_t& fractionDigitCount)
+{
+    return Fixed{value, fractionDigitCount};
+}
+
+TxWriter::TxWriter(AbstractSocket& socket)
+    : _socket(socket)
+{}
+
+TxWriter::~TxWriter(void)
+{
+    flush();
+}
+
+TxWriter& TxWriter::operator<<(const char* text)
+{
+    while (*text)
+    {
+        put(*text++);
+    }
+
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const char& character)
+{
+    put(character);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const unsigned char& value)
+{
+    putUnsigned(value);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const int& value)
+{
+    putSigned(value);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const unsigned int& value)
+{
+    putUnsigned(value);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const long& value)
+{
+    /* A 32 bit long, as on AVR, stays clear of the 64 bit arithmetic. */
+#if LONG_MAX > INT32_MAX
+    putWideSigned(value);
+#else
+    putSigned(value);
+#endif
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const unsigned long& value)
+{
+#if LONG_MAX > INT32_MAX
+    putWideUnsigned(value);
+#else
+    putUnsigned(value);
+#endif
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const long long& value)
+{
+    putWideSigned(value);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const unsigned long long& value)
+{
+    putWideUnsigned(value);
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const Hex& value)
+{
+    char digits[8];
+    uint8_t digitCount = 0;
+    uint32_t remainder = value.value;
+
+    do
+    {
+        const uint8_t nibble = remainder & 0x0f;
+        digits[digitCount++] = static_cast<char>(nibble < 10 ? '0' + nibble : 'a' + nibble - 10);
+        remainder >>= 4;
+    } while (remainder && digitCount < 8);
+
+    for (uint8_t i = digitCount; i < value.digitCount; i++)
+    {
+        put('0');
+    }
+
+    while (digitCount)
+    {
+        put(digits[--digitCount]);
+    }
+
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const Fixed& value)
+{
+    uint32_t magnitude = value.value < 0 ? 0 - static_cast<uint32_t>(value.value) : value.value;
+    const uint8_t fractionDigitCount = value.fractionDigitCount > _maximumFractionDigitCount
+                                           ? _maximumFractionDigitCount
+                                           : value.fractionDigitCount;
+    uint32_t divisor = 1;
+
+    for (uint8_t i = 0; i < fractionDigitCount; i++)
+    {
+        divisor *= 10;
+    }
+
+    if (value.value < 0)
+    {
+        put('-');
+    }
+
+    putUnsigned(magnitude / divisor);
+
+    if (fractionDigitCount)
+    {
+        put('.');
+        putUnsigned(magnitude % divisor, fractionDigitCount);
+    }
+
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const HostAddress& address)
+{
+    const unsigned char* addressBytes = address.toArray();
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        if (i)
+        {
+            put('.');
+        }
+
+        putUnsigned(addressBytes[i]);
+    }
+
+    return *this;
+}
+
+TxWriter& TxWriter::operator<<(const MacAddress& address)
+{
+    const unsigned char* addressBytes = address.toArray();
+
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        if (i)
+        {
+            put('-');
+        }
+
+        *this << hex(addressBytes[i], 2);
+    }
+
+    return *this;
+}
+
+void TxWriter::write(const uint8_t* data, const uint16_t& length)
+{
+    if (length >= _windowSize)
+    {
+        writeWindow();
+        _isComplete = _isComplete && length == _socket.bufferData(data, length);
+        return;
+    }
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        put(static_cast<char>(data[i]));
+    }
+}
+
+bool TxWriter::flush(void)
+{
+    writeWindow();
+    _socket.commitData();
+
+    const bool isComplete = _isComplete;
+    _isComplete = true;
+    return isComplete;
+}
+
+void TxWriter::put(const char& character)
+{
+    if (_windowSize == _windowLength)
+    {
+        writeWindow();
+    }
+
+    _window[_windowLength++] = static_cast<uint8_t>(character);
+}
+
+void TxWriter::putUnsigned(uint32_t value, const uint8_t& minimumDigitCount)
+{
+    char digits[10];
+    uint8_t digitCount = 0;
+
+    do
+    {
+        digits[digitCount++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+
+    for (uint8_t i = digitCount; i < minimumDigitCount; i++)
+    {
+        put('0');
+    }
+
+    while (digitCount)
+    {
+        put(digits[--digitCount]);
+    }
+}
+
+void TxWriter::putSigned(const int32_t& value)
+{
+    if (value < 0)
+    {
+        put('-');
+        putUnsigned(0 - static_cast<uint32_t>(value));
+    }
+    else
+    {
+        putUnsigned(static_cast<uint32_t>(value));
+    }
+}
+
+void TxWriter::putWideUnsigned(const uint64_t& value)
+{
+    if (value > UINT32_MAX)
+    {
+        putWideUnsigned(value / _digitGroupDivisor);
+        putUnsigned(static_cast<uint32_t>(value % _digitGroupDivisor), _digitGroupLength);
+    }
+    else
+    {
+        putUnsigned(static_cast<uint32_t>(value));
+    }
+}
+
+void TxWriter::putWideSigned(const int64_t& value)
+{
+    if (value < 0)
+    {
+        put('-');
+        putWideUnsigned(0 - static_cast<uint64_t>(value));
+    }
+    else
+    {
+        putWideUnsigned(static_cast<uint64_t>(value));
+    }
+}
+
+void TxWriter::writeWindow(void)
+{
+    if (_windowLength)
+    {
+        _isComplete = _isComplete && _windowLength == _socket.bufferData(_window, _windowLength);
+        _windowLength = 0;
+    }
+}
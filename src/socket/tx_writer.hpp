@@ -0,0 +1,217 @@
+/**
+ *  \file   tx_writer.hpp
+ *  \brief  The file contains declaration for the TxWriter class.
+ */
+
+#ifndef __TX_WRITER_HPP__
+#define __TX_WRITER_HPP__
+
+#include <stdint.h>
+
+#include "../address/host_address.hpp"
+#include "../address/mac_address.hpp"
+
+class AbstractSocket;
+
+/**
+ *  \class  TxWriter
+ *  \brief  The class formats values straight into a socket's TX buffer.
+ *
+ *  Rendered characters are collected in a small window, which is written to
+ *  the TX buffer in one SPI frame whenever it runs full. Nothing is sent
+ *  before flush() is called or the writer goes out of scope, so a report
+ *  made of many fields ends up in a single SEND (or is combined further if
+ *  the socket coalesces writes). Numbers are rendered without printf, and
+ *  fractional values are passed as scaled integers.
+ *
+ *  \code
+ *  TxWriter(socket) << "temp=" << TxWriter::fixed(2315, 2) << " ip=" << address << "\r\n";
+ *  \endcode
+ */
+class TxWriter
+{
+public:
+    /**
+     *  \struct Hex
+     *  \brief  An unsigned value to be rendered in hexadecimal digits.
+     */
+    struct Hex
+    {
+        uint32_t value;
+        uint8_t digitCount;
+    };
+
+    /**
+     *  \struct Fixed
+     *  \brief  A scaled integer to be rendered as a decimal fraction.
+     */
+    struct Fixed
+    {
+        int32_t value;
+        uint8_t fractionDigitCount;
+    };
+
+    /**
+     *  \fn         hex(const uint32_t& value, const uint8_t& digitCount = 0)
+     *  \brief      Marks a value for hexadecimal output.
+     *  \param[in]  value passes the value to render.
+     *  \param[in]  digitCount passes the minimum number of digits, padded with zeros.
+     *  \return     The value wrapped for operator<<.
+     */
+    static Hex hex(const uint32_t& value, const uint8_t& digitCount = 0);
+
+    /**
+     *  \fn         fixed(const int32_t& value, const uint8_t& fractionDigitCount)
+     *  \brief      Marks a scaled integer for fixed-point output.
+     *  \param[in]  value passes the value multiplied by 10^fractionDigitCount.
+     *  \param[in]  fractionDigitCount passes the number of digits after the point, at most 9.
+     *  \return     The value wrapped for operator<<, e.g. fixed(2315, 2) renders "23.15".
+     *
+     *  operator<< renders larger digit counts as 9, the largest power of ten
+     *  fitting the 32 bit divisor. The count is not changed here, so values
+     *  built without fixed() are treated the same way.
+     */
+    static Fixed fixed(const int32_t& value, const uint8_t& fractionDigitCount);
+
+    /**
+     *  \fn         TxWriter(AbstractSocket& socket)
+     *  \brief      The constructor initializes an instance of type 'TxWriter'.
+     *  \param[in]  socket passes the socket to write to.
+     */
+    TxWriter(AbstractSocket& socket);
+
+    /**
+     *  \fn     ~TxWriter(void)
+     *  \brief  The destructor flushes the remaining output.
+     */
+    ~TxWriter(void);
+
+    TxWriter(const TxWriter&) = delete;
+    TxWriter& operator=(const TxWriter&) = delete;
+
+    TxWriter& operator<<(const char* text);
+    TxWriter& operator<<(const char& character);
+    TxWriter& operator<<(const unsigned char& value);
+    TxWriter& operator<<(const int& value);
+    TxWriter& operator<<(const unsigned int& value);
+    TxWriter& operator<<(const long& value);
+    TxWriter& operator<<(const unsigned long& value);
+    TxWriter& operator<<(const long long& value);
+    TxWriter& operator<<(const unsigned long long& value);
+    TxWriter& operator<<(const Hex& value);
+    TxWriter& operator<<(const Fixed& value);
+    TxWriter& operator<<(const HostAddress& address);
+    TxWriter& operator<<(const MacAddress& address);
+
+    /**
+     *  \fn         write(const uint8_t* data, const uint16_t& length)
+     *  \brief      Appends raw bytes to the output.
+     *  \param[in]  data passes the bytes to append.
+     *  \param[in]  length passes the number of bytes.
+     */
+    void write(const uint8_t* data, const uint16_t& length);
+
+    /**
+     *  \fn     flush(void)
+     *  \brief  Writes the window to the TX buffer and sends the output.
+     *  \return Boolean indicating whether all output reached the TX buffer.
+     */
+    bool flush(void);
+
+private:
+    /**
+     *  \fn         put(const char& character)
+     *  \brief      Appends a single character to the window.
+     *  \param[in]  character passes the character to append.
+     */
+    void put(const char& character);
+
+    /**
+     *  \fn         putUnsigned(uint32_t value, const uint8_t& minimumDigitCount = 1)
+     *  \brief      Renders an unsigned value in decimal digits.
+     *  \param[in]  value passes the value to render.
+     *  \param[in]  minimumDigitCount passes the minimum number of digits, padded with zeros.
+     */
+    void putUnsigned(uint32_t value, const uint8_t& minimumDigitCount = 1);
+
+    /**
+     *  \fn         putSigned(const int32_t& value)
+     *  \brief      Renders a signed value in decimal digits.
+     *  \param[in]  value passes the value to render.
+     */
+    void putSigned(const int32_t& value);
+
+    /**
+     *  \fn         putWideUnsigned(const uint64_t& value)
+     *  \brief      Renders an unsigned 64 bit value in decimal digits.
+     *  \param[in]  value passes the value to render.
+     *
+     *  Values fitting 32 bits are passed to putUnsigned(), larger ones are
+     *  split into groups of nine digits, so the 64 bit division only runs
+     *  for values that need it.
+     */
+    void putWideUnsigned(const uint64_t& value);
+
+    /**
+     *  \fn         putWideSigned(const int64_t& value)
+     *  \brief      Renders a signed 64 bit value in decimal digits.
+     *  \param[in]  value passes the value to render.
+     */
+    void putWideSigned(const int64_t& value);
+
+    /**
+     *  \fn     writeWindow(void)
+     *  \brief  Moves the window's content into the socket's TX buffer.
+     */
+    void writeWindow(void);
+
+    /**
+     *  \var    _windowSize
+     *  \brief  Number of characters combined into one TX buffer write.
+     */
+    static constexpr uint8_t _windowSize = 32;
+
+    /**
+     *  \var    _maximumFractionDigitCount
+     *  \brief  Number of fraction digits whose power of ten still fits the 32 bit divisor.
+     */
+    static constexpr uint8_t _maximumFractionDigitCount = 9;
+
+    /**
+     *  \var    _digitGroupLength
+     *  \brief  Number of decimal digits rendered per 32 bit group of a 64 bit value.
+     */
+    static constexpr uint8_t _digitGroupLength = 9;
+
+    /**
+     *  \var    _digitGroupDivisor
+     *  \brief  The power of ten splitting 64 bit values into 32 bit digit groups.
+     */
+    static constexpr uint32_t _digitGroupDivisor = 1000000000;
+
+    /**
+     *  \var    _socket
+     *  \brief  The socket to write to.
+     */
+    AbstractSocket& _socket;
+
+    /**
+     *  \var    _window
+     *  \brief  The characters rendered but not yet written to the TX buffer.
+     */
+    uint8_t _window[_windowSize];
+
+    /**
+     *  \var    _windowLength
+     *  \brief  Number of characters in the window.
+     */
+    uint8_t _windowLength = 0;
+
+    /**
+     *  \var    _isComplete
+     *  \brief  Indicates that no output was dropped so far.
+     */
+    bool _isComplete = true;
+};
+
+#endif //__TX_WRITER_HPP__
@@ -5,15 +5,46 @@
 
 #include "udp_socket.hpp"
 
+#include "../chip/wiznet_w5500.hpp"
+
 UdpSocket::UdpSocket(void)
     : AbstractSocket()
 {
-    constexpr uint16_t SnModeRegisterAddress = 0x0000;
-    constexpr unsigned char socketMode = 0x02;
-    writeControlRegister(SnModeRegisterAddress, &socketMode, 1);
+}
+
+void UdpSocket::bind(W5500* chipInterface,
+                     const uint16_t& port,
+                     const uint8_t& txBufferSize,
+                     const uint8_t& rxBufferSize)
+{
+    _chipInterface = chipInterface;
+    invalidateShadowRegisters();
+
+    if (_chipInterface)
+    {
+        _index = _chipInterface->registerSocket(this, txBufferSize, rxBufferSize);
+
+        if (W5500::invalidSocketIndex == _index)
+        {
+            _chipInterface = nullptr;
+            return;
+        }
+
+        _socketBlockBits = getSocketBlockBits(_index);
+    }
+
+    specifyType();
+    setLocalPort(port);
+    setInterruptMask(_interruptMask);
 }
 
 bool UdpSocket::isOpen(void)
 {
-    return false;
-}
\ No newline at end of file
+    return refreshStatus() == SocketStatus::Udp;
+}
+
+void UdpSocket::specifyType(void)
+{
+    constexpr unsigned char socketMode = 0x02;
+    setMode(socketMode);
+}
@@ -21,10 +21,26 @@ public:
      */
     UdpSocket(void);
 
+    /**
+     *  \fn             bind(W5500* chipInterface, const uint16_t& port, const uint8_t& txBufferSize, const uint8_t& rxBufferSize) override
+     *  \brief          Binds the socket to a port of the passed chip.
+     *  \param[inout]   chipInterface passes a pointer to the W5500 interface instance.
+     *  \param[in]      port passes the 16 bit source port value.
+     *  \param[in]      txBufferSize passes the TX buffer size in KB.
+     *  \param[in]      rxBufferSize passes the RX buffer size in KB.
+     *
+     *  If the chip has no free socket or not enough buffer memory left, the
+     *  socket stays unbound.
+     */
+    virtual void bind(W5500* chipInterface,
+                      const uint16_t& port,
+                      const uint8_t& txBufferSize = 2,
+                      const uint8_t& rxBufferSize = 2) override;
+
     /**
      *  \fn       isOpen(void)
      *  \brief    Checks whether the socket is open or not.
-     *  \return   Boolean indication the socket opening status.
+     *  \return   Boolean indicating that Sn_SR reports SOCK_UDP.
      */
     virtual bool isOpen(void) override;
 
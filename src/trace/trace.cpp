@@ -0,0 +1,83 @@
+/**
+ *  \file   trace.cpp
+ *  \brief  The file contains implementation for the Trace class.
+ */
+
+#include "trace.hpp"
+
+#ifdef W5500_TRACE
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+
+static_assert(W5500_TRACE_CAPACITY > 0 && W5500_TRACE_CAPACITY <= 255, "The trace capacity must fit a uint8_t.");
+
+TraceRecord Trace::_records[W5500_TRACE_CAPACITY];
+uint8_t Trace::_head = 0;
+uint8_t Trace::_count = 0;
+uint16_t Trace::_overwrittenCount = 0;
+
+void Trace::record(const TraceEvent& event, const uint8_t& socket, const uint16_t& argument)
+{
+    const unsigned char interruptState = SREG;
+    cli();
+
+    const uint16_t unwrappedTail = _head + _count;
+    const uint8_t tail = unwrappedTail >= W5500_TRACE_CAPACITY ? unwrappedTail - W5500_TRACE_CAPACITY
+                                                               : unwrappedTail;
+
+    if (W5500_TRACE_CAPACITY == _count)
+    {
+        _head = _head + 1 == W5500_TRACE_CAPACITY ? 0 : _head + 1;
+
+        if (0xffff != _overwrittenCount)
+        {
+            _overwrittenCount++;
+        }
+    }
+    else
+    {
+        _count++;
+    }
+
+    TraceRecord& traceRecord = _records[tail];
+    traceRecord.timestamp = W5500_TRACE_TIMESTAMP;
+    traceRecord.event = static_cast<uint8_t>(event);
+    traceRecord.socket = socket;
+    traceRecord.argument = argument;
+
+    SREG = interruptState;
+}
+
+uint8_t Trace::drain(TraceRecord* destination, const uint8_t& maximum)
+{
+    const unsigned char interruptState = SREG;
+    cli();
+
+    uint8_t recordCount = 0;
+
+    for (; recordCount < maximum && _count; recordCount++)
+    {
+        destination[recordCount] = _records[_head];
+        _head = _head + 1 == W5500_TRACE_CAPACITY ? 0 : _head + 1;
+        _count--;
+    }
+
+    _overwrittenCount = 0;
+
+    SREG = interruptState;
+    return recordCount;
+}
+
+uint16_t Trace::getOverwrittenCount(void)
+{
+    const unsigned char interruptState = SREG;
+    cli();
+
+    const uint16_t overwrittenCount = _overwrittenCount;
+
+    SREG = interruptState;
+    return overwrittenCount;
+}
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ *  \file   trace.hpp
+ *  \brief  The file contains declaration for the Trace class.
+ *
+ *  Tracing is compiled in by defining W5500_TRACE. Otherwise the
+ *  W5500_TRACE_EVENT() calls expand to nothing and no RAM is reserved.
+ */
+
+#ifndef __TRACE_HPP__
+#define __TRACE_HPP__
+
+#include <stdint.h>
+
+#include "trace_record.hpp"
+
+/**
+ *  \def    W5500_TRACE_CAPACITY
+ *  \brief  The number of records kept by the trace, adjustable at compile time.
+ */
+#ifndef W5500_TRACE_CAPACITY
+#define W5500_TRACE_CAPACITY 64
+#endif
+
+/**
+ *  \def    W5500_TRACE_TIMESTAMP
+ *  \brief  The expression read as timestamp, a free running 16 bit timer by default.
+ */
+#ifndef W5500_TRACE_TIMESTAMP
+#define W5500_TRACE_TIMESTAMP TCNT1
+#endif
+
+#ifdef W5500_TRACE
+#define W5500_TRACE_EVENT(event, socket, argument) Trace::record((event), (socket), (argument))
+#else
+#define W5500_TRACE_EVENT(event, socket, argument) ((void)0)
+#endif
+
+/**
+ *  \class  Trace
+ *  \brief  A static ring buffer of timestamped driver events.
+ *
+ *  Records may be added from ISRs and from the main loop. When the ring is
+ *  full, the oldest record is overwritten, so the trace always holds the
+ *  latest events. The drained records are meant to be sent to a host, e.g.
+ *  over a UART, and decoded by the W5500_TraceDecoder tool of the
+ *  simulation build.
+ */
+class Trace
+{
+public:
+    /**
+     *  \fn         record(const TraceEvent& event, const uint8_t& socket, const uint16_t& argument)
+     *  \brief      Appends a record stamped with W5500_TRACE_TIMESTAMP.
+     *  \param[in]  event passes the recorded event.
+     *  \param[in]  socket passes the socket index or control byte of the event.
+     *  \param[in]  argument passes the event specific value.
+     */
+    static void record(const TraceEvent& event, const uint8_t& socket, const uint16_t& argument);
+
+    /**
+     *  \fn         drain(TraceRecord* destination, const uint8_t& maximum)
+     *  \brief      Moves the oldest records out of the trace.
+     *  \param[out] destination passes the array receiving the records.
+     *  \param[in]  maximum passes the capacity of the destination.
+     *  \return     The number of records copied.
+     */
+    static uint8_t drain(TraceRecord* destination, const uint8_t& maximum);
+
+    /**
+     *  \fn     getOverwrittenCount(void)
+     *  \brief  Returns the number of records lost since the last drain, saturating at 0xffff.
+     *  \return The number of overwritten records.
+     */
+    static uint16_t getOverwrittenCount(void);
+
+private:
+    /**
+     *  \var    _records
+     *  \brief  The ring of records.
+     */
+    static TraceRecord _records[W5500_TRACE_CAPACITY];
+
+    /**
+     *  \var    _head
+     *  \brief  The index of the oldest record.
+     */
+    static uint8_t _head;
+
+    /**
+     *  \var    _count
+     *  \brief  The number of records in the ring.
+     */
+    static uint8_t _count;
+
+    /**
+     *  \var    _overwrittenCount
+     *  \brief  The number of records lost since the last drain.
+     */
+    static uint16_t _overwrittenCount;
+};
+
+#endif //__TRACE_HPP__
@@ -0,0 +1,55 @@
+/**
+ *  \file   trace_record.hpp
+ *  \brief  The file contains the record format of the driver trace.
+ *
+ *  The header has no AVR dependencies, so the host side decoder shares the
+ *  event numbers and the record layout with the library.
+ */
+
+#ifndef __TRACE_RECORD_HPP__
+#define __TRACE_RECORD_HPP__
+
+#include <stdint.h>
+
+/**
+ *  \enum   TraceEvent
+ *  \brief  The driver events recorded by the trace.
+ */
+enum class TraceEvent : uint8_t
+{
+    InterruptNotify = 0,
+    InterruptPass = 1,
+    FrameStart = 2,
+    FrameEnd = 3,
+    Send = 4,
+    SendComplete = 5,
+    Receive = 6,
+    StateChange = 7
+};
+
+/**
+ *  \struct TraceRecord
+ *  \brief  A single trace entry of six bytes.
+ *
+ *  The meaning of 'socket' and 'argument' depends on the event:
+ *  - InterruptNotify: unused.
+ *  - InterruptPass: argument holds SIR.
+ *  - FrameStart: socket holds the control byte, argument the address.
+ *  - FrameEnd: socket holds the control byte, argument the data length.
+ *  - Send: argument holds the number of bytes sent.
+ *  - SendComplete: unused argument.
+ *  - Receive: argument holds the number of bytes released.
+ *  - StateChange: argument holds the TcpState above the Sn_SR value.
+ *
+ *  The record is dumped as is, so the timestamp and the argument are
+ *  stored little endian like on the AVR.
+ */
+struct TraceRecord
+{
+    uint16_t timestamp;
+    uint8_t event;
+    uint8_t socket;
+    uint16_t argument;
+};
+
+#endif //__TRACE_RECORD_HPP__
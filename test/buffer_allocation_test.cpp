@@ -0,0 +1,89 @@
+/**
+ *  \file   buffer_allocation_test.cpp
+ *  \brief  Assigns the shared TX and RX memories to sockets on registration.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+/* Checks the simulated Sn_TXBUF_SIZE and Sn_RXBUF_SIZE of a socket in KB. */
+void checkBufferSizes(const W5500Simulator& simulator,
+                      const uint8_t& socket,
+                      const unsigned char& txBufferSize,
+                      const unsigned char& rxBufferSize)
+{
+    CHECK(txBufferSize == simulator.getSocketRegister(socket, 0x001f));
+    CHECK(rxBufferSize == simulator.getSocketRegister(socket, 0x001e));
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    /* Sizes other than powers of two up to 16 KB are rejected. */
+    TcpSocket invalidSocket;
+    invalidSocket.bind(&chip, 1000, 3, 2);
+    CHECK(W5500::invalidSocketIndex == invalidSocket.getIndex());
+    invalidSocket.bind(&chip, 1000, 2, 32);
+    CHECK(W5500::invalidSocketIndex == invalidSocket.getIndex());
+    checkBufferSizes(simulator, 0, 2, 2);
+
+    /* Buffers of unregistered sockets are released once the default
+       sizes don't fit next to the requested ones anymore, but only in
+       the direction that overflows. */
+    TcpSocket largeSocket;
+    largeSocket.bind(&chip, 1001, 8, 2);
+    CHECK(0 == largeSocket.getIndex());
+    checkBufferSizes(simulator, 0, 8, 2);
+
+    for (uint8_t i = 1; i < 8; i++)
+    {
+        checkBufferSizes(simulator, i, 0, 2);
+    }
+
+    {
+        TcpSocket secondSocket;
+        secondSocket.bind(&chip, 1002, 8, 8);
+        CHECK(1 == secondSocket.getIndex());
+        checkBufferSizes(simulator, 1, 8, 8);
+
+        for (uint8_t i = 2; i < 8; i++)
+        {
+            checkBufferSizes(simulator, i, 0, 0);
+        }
+
+        /* The TX memory is exhausted now, so even a 1 KB TX buffer doesn't fit. */
+        TcpSocket rejectedSocket;
+        rejectedSocket.bind(&chip, 1003, 1, 1);
+        CHECK(W5500::invalidSocketIndex == rejectedSocket.getIndex());
+
+        TcpSocket receiveOnlySocket;
+        receiveOnlySocket.bind(&chip, 1004, 0, 4);
+        CHECK(2 == receiveOnlySocket.getIndex());
+        checkBufferSizes(simulator, 2, 0, 4);
+
+        rejectedSocket.bind(&chip, 1003, 0, 4);
+        CHECK(W5500::invalidSocketIndex == rejectedSocket.getIndex());
+    }
+
+    /* Destroyed sockets give their memory back to later registrations,
+       released buffers that still fit keep their size. */
+    TcpSocket reusingSocket;
+    reusingSocket.bind(&chip, 1005, 8, 12);
+    CHECK(W5500::invalidSocketIndex == reusingSocket.getIndex());
+    reusingSocket.bind(&chip, 1005, 8, 8);
+    CHECK(1 == reusingSocket.getIndex());
+    checkBufferSizes(simulator, 1, 8, 8);
+    checkBufferSizes(simulator, 2, 0, 4);
+
+    TcpSocket thirdSocket;
+    thirdSocket.bind(&chip, 1006, 0, 8);
+    CHECK(W5500::invalidSocketIndex == thirdSocket.getIndex());
+    thirdSocket.bind(&chip, 1006, 0, 4);
+    CHECK(2 == thirdSocket.getIndex());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/**
+ *  \file   burst_transfer_test.cpp
+ *  \brief  Counts the SPI traffic of socket buffer transfers longer than 255 bytes.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+constexpr uint16_t largeLength = 1001;
+
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+/* Fixed length data mode needs 250 more four byte frames, each with its own header. */
+constexpr uint32_t extraFrames = 250;
+#else
+/* The payload shares one frame with its header however long it is. */
+constexpr uint32_t extraFrames = 0;
+#endif
+
+constexpr uint32_t extraBytes = (largeLength - 1) + 3 * extraFrames;
+
+/* Returns the statistics of the SPI traffic since the last reset. */
+W5500Simulator::Statistics takeStatistics(W5500Simulator& simulator)
+{
+    const W5500Simulator::Statistics statistics = simulator.getStatistics();
+    simulator.resetStatistics();
+    return statistics;
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket, 1000, 50000, 8, 8);
+
+    const uint8_t index = socket.getIndex();
+
+    static unsigned char data[largeLength];
+
+    for (uint16_t i = 0; i < largeLength; i++)
+    {
+        data[i] = static_cast<unsigned char>(i * 7);
+    }
+
+    /* A one byte send is the reference for the frames around the payload. */
+    CHECK(1 == socket.send(data, 1));
+    chip.handleInterrupt();
+    expectTransmitted(index, data, 1);
+
+    simulator.resetStatistics();
+    CHECK(1 == socket.send(data, 1));
+    const W5500Simulator::Statistics smallSend = takeStatistics(simulator);
+    chip.handleInterrupt();
+    expectTransmitted(index, data, 1);
+
+    simulator.resetStatistics();
+    CHECK(largeLength == socket.send(data, largeLength));
+    const W5500Simulator::Statistics largeSend = takeStatistics(simulator);
+    chip.handleInterrupt();
+    expectTransmitted(index, data, largeLength);
+
+    CHECK(smallSend.frameCount + extraFrames == largeSend.frameCount);
+    CHECK(smallSend.byteCount + extraBytes == largeSend.byteCount);
+    CHECK(smallSend.dataByteCount + largeLength - 1 == largeSend.dataByteCount);
+
+    /* Receiving is the same, one frame for the whole payload. */
+    unsigned char received[largeLength] = {};
+    CHECK(simulator.injectData(index, data, 1) == 1);
+    chip.handleInterrupt();
+    simulator.resetStatistics();
+    CHECK(1 == socket.recv(received, 1));
+    const W5500Simulator::Statistics smallRecv = takeStatistics(simulator);
+
+    CHECK(simulator.injectData(index, data, largeLength) == largeLength);
+    chip.handleInterrupt();
+    simulator.resetStatistics();
+    CHECK(largeLength == socket.recv(received, largeLength));
+    const W5500Simulator::Statistics largeRecv = takeStatistics(simulator);
+    CHECK(0 == memcmp(received, data, largeLength));
+
+    CHECK(smallRecv.frameCount + extraFrames == largeRecv.frameCount);
+    CHECK(smallRecv.byteCount + extraBytes == largeRecv.byteCount);
+    CHECK(smallRecv.dataByteCount + largeLength - 1 == largeRecv.dataByteCount);
+
+    return EXIT_SUCCESS;
+}
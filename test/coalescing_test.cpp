@@ -0,0 +1,85 @@
+/**
+ *  \file   coalescing_test.cpp
+ *  \brief  Combines small writes into one SEND by byte threshold, flush() and tick limit.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    static unsigned char message[100];
+
+    for (uint16_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = static_cast<unsigned char>(i);
+    }
+
+    /* Writes below the threshold only append to the TX buffer. */
+    socket.setTXCoalescing(100);
+    simulator.resetStatistics();
+
+    CHECK(40 == socket.send(message, 40));
+    CHECK(40 == socket.send(message + 40, 40));
+    CHECK(0 == simulator.getStatistics().sendCommandCount);
+    CHECK(simulator.takeTransmittedData(index).empty());
+
+    socket.flush();
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+    expectTransmitted(index, message, 80);
+
+    socket.flush();
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    /* Reaching the threshold sends everything pending at once. */
+    CHECK(60 == socket.send(message, 60));
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+    CHECK(40 == socket.send(message + 60, 40));
+    CHECK(2 == simulator.getStatistics().sendCommandCount);
+    expectTransmitted(index, message, sizeof(message));
+
+    /* Pending data is sent after the tick limit, counted from the first pending write. */
+    socket.setTXCoalescing(1000, 3);
+    simulator.resetStatistics();
+
+    chip.notifyTick();
+    chip.poll();
+    CHECK(10 == socket.send(message, 10));
+
+    chip.notifyTick();
+    chip.notifyTick();
+    chip.poll();
+    CHECK(0 == simulator.getStatistics().sendCommandCount);
+
+    CHECK(10 == socket.send(message + 10, 10));
+    chip.notifyTick();
+    chip.poll();
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+    CHECK(20 == simulator.takeTransmittedData(index).size());
+
+    socket.tick();
+    socket.tick();
+    socket.tick();
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    /* Lowering the threshold below the pending length sends immediately. */
+    CHECK(5 == socket.send(message, 5));
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+    socket.setTXCoalescing(0);
+    CHECK(2 == simulator.getStatistics().sendCommandCount);
+    CHECK(5 == simulator.takeTransmittedData(index).size());
+
+    CHECK(5 == socket.send(message, 5));
+    CHECK(3 == simulator.getStatistics().sendCommandCount);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/**
+ *  \file   delegate_test.cpp
+ *  \brief  Fires plain functions and member callbacks registered for socket events.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+uint8_t connectedCount = 0;
+
+void onConnected(void)
+{
+    connectedCount++;
+}
+
+/* Counts the events and received bytes through member callbacks. */
+class EventCounter : public CallbackInstance
+{
+public:
+    void onConnected(void) { connectedCount++; }
+
+    void onReceived(AbstractSocket&, RxView& receivedData) { receivedByteCount += receivedData.consume(0xffff); }
+
+    uint8_t connectedCount = 0;
+    uint16_t receivedByteCount = 0;
+};
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    listenTestSocket(chip, socket);
+
+    EventCounter counter;
+    Callback connectedCallback(&counter, &EventCounter::onConnected);
+    ReceiveCallback receivedCallback(&counter, &EventCounter::onReceived);
+
+    CHECK(socket.addCallbackFunction(SocketEvent::Connected, onConnected));
+    CHECK(socket.addCallback(SocketEvent::Connected, connectedCallback));
+    CHECK(socket.addReceiveCallback(receivedCallback));
+
+    const uint8_t index = socket.getIndex();
+    connectTestPeer(chip, socket);
+    CHECK(1 == connectedCount);
+    CHECK(1 == counter.connectedCount);
+
+    const unsigned char request[5] = {'h', 'e', 'l', 'l', 'o'};
+    CHECK(simulator.injectData(index, request, sizeof(request)) == sizeof(request));
+    chip.handleInterrupt();
+    CHECK(sizeof(request) == counter.receivedByteCount);
+    CHECK(0 == socket.available());
+    CHECK(1 == connectedCount);
+
+    /* A callback without instance is stored like an empty function. */
+    Delegate<> emptyDelegate{Callback()};
+    emptyDelegate.fire();
+    Delegate<>().fire();
+
+    RxView receivedData = socket.view();
+    Delegate<AbstractSocket&, RxView&>{ReceiveCallback()}.fire(socket, receivedData);
+
+    return EXIT_SUCCESS;
+}
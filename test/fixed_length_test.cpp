@@ -0,0 +1,69 @@
+/**
+ *  \file   fixed_length_test.cpp
+ *  \brief  Transfers data in fixed length data mode with SCSn held low.
+ *
+ *  The test is compiled with W5500_FIXED_LENGTH_DATA_MODE regardless of the
+ *  configuration of the library target.
+ */
+
+#include "test_socket.hpp"
+
+#include <avr/interrupt.h>
+#include <string.h>
+
+ISR(SPI_STC_vect)
+{
+    W5500::handleTransferInterrupt();
+}
+
+namespace
+{
+/* Checks that every frame since the last reset carried 1, 2 or 4 data bytes behind its header. */
+void checkFixedLengthFrames(const W5500Simulator::Statistics& statistics)
+{
+    CHECK(0 == statistics.chipSelectCount);
+    CHECK(statistics.byteCount == statistics.dataByteCount + 3 * statistics.frameCount);
+    CHECK(statistics.dataByteCount <= 4 * statistics.frameCount);
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+    CHECK(chip.isConfigured());
+    CHECK(1 == simulator.getStatistics().chipSelectCount);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+    CHECK(socket.isConnected());
+
+    /* 11 bytes are split into chunks of 4, 4, 2 and 1 byte. */
+    const char message[] = "fixed frame";
+    simulator.resetStatistics();
+    CHECK(socket.send(message) == strlen(message));
+    checkFixedLengthFrames(simulator.getStatistics());
+
+    expectTransmitted(socket.getIndex(), message);
+
+    const unsigned char request[7] = {1, 2, 3, 4, 5, 6, 7};
+    CHECK(simulator.injectData(socket.getIndex(), request, sizeof(request)) == sizeof(request));
+    chip.handleInterrupt();
+
+    unsigned char received[sizeof(request)] = {};
+    simulator.resetStatistics();
+    CHECK(socket.recv(received, sizeof(received)) == sizeof(request));
+    CHECK(0 == memcmp(received, request, sizeof(request)));
+    checkFixedLengthFrames(simulator.getStatistics());
+
+    static unsigned char payload[13];
+    memset(payload, 'F', sizeof(payload));
+    simulator.resetStatistics();
+    CHECK(socket.sendAsync(payload, sizeof(payload)) == sizeof(payload));
+    CHECK(!chip.isTransferPending());
+    checkFixedLengthFrames(simulator.getStatistics());
+
+    expectTransmitted(socket.getIndex(), payload, sizeof(payload));
+
+    return EXIT_SUCCESS;
+}
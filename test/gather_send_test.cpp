@@ -0,0 +1,50 @@
+/**
+ *  \file   gather_send_test.cpp
+ *  \brief  Sends several segments as one message with a single SEND.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket, 1000, 50000, 1, 2);
+
+    const uint8_t index = socket.getIndex();
+
+    const uint8_t header[4] = {0xca, 0xfe, 0x00, 0x05};
+    const uint8_t payload[5] = {'h', 'e', 'l', 'l', 'o'};
+    const TxSegment segments[3] = {{header, sizeof(header)}, {nullptr, 0}, {payload, sizeof(payload)}};
+
+    simulator.resetStatistics();
+    CHECK(sizeof(header) + sizeof(payload) == socket.send(segments, 3));
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    std::vector<unsigned char> transmittedData = simulator.takeTransmittedData(index);
+    CHECK(transmittedData.size() == sizeof(header) + sizeof(payload));
+    CHECK(0 == memcmp(transmittedData.data(), header, sizeof(header)));
+    CHECK(0 == memcmp(transmittedData.data() + sizeof(header), payload, sizeof(payload)));
+
+    /* Messages not fitting into the 1 KB TX buffer, or whose length doesn't
+       fit 16 bits, are rejected before any SPI traffic. */
+    static uint8_t block[1024];
+    const TxSegment oversizedSegments[2] = {{block, sizeof(block)}, {payload, 1}};
+    const TxSegment wrappingSegments[2] = {{block, 0xffff}, {payload, 2}};
+
+    simulator.resetStatistics();
+    CHECK(0 == socket.send(oversizedSegments, 2));
+    CHECK(0 == socket.send(wrappingSegments, 2));
+    CHECK(0 == socket.send(segments, 0));
+    CHECK(0 == simulator.getStatistics().frameCount);
+
+    const TxSegment fittingSegments[1] = {{block, sizeof(block)}};
+    CHECK(sizeof(block) == socket.send(fittingSegments, 1));
+    CHECK(sizeof(block) == simulator.takeTransmittedData(index).size());
+
+    return EXIT_SUCCESS;
+}
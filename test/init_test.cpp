@@ -0,0 +1,51 @@
+/**
+ *  \file   init_test.cpp
+ *  \brief  Initializes the common registers with and without verifying them.
+ *
+ *  The test is built twice from the library sources, once with
+ *  W5500_FAST_BOOT and once without, regardless of the configuration of
+ *  the library target.
+ */
+
+#include "test_socket.hpp"
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+
+    /* The PHY reset pulse keeps the operation mode strapped by PMODE. */
+    simulator.setPhyModePins(0x03);
+    simulator.resetStatistics();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+    CHECK(chip.isConfigured());
+    CHECK(0x9f == simulator.getCommonRegister(0x002e));
+
+    /* The network configuration is written as one burst of 18 bytes. */
+    const unsigned char networkConfiguration[18] = {192,  168,  178,  1,    255, 255, 255, 0,   0x00,
+                                                    0x08, 0xdc, 0xff, 0xff, 0xff, 192, 168, 178, 101};
+
+    for (uint8_t i = 0; i < sizeof(networkConfiguration); i++)
+    {
+        CHECK(networkConfiguration[i] == simulator.getCommonRegister(0x0001 + i));
+    }
+
+    /* VERSIONR, MR, the PHYCFGR read and its two pulse writes, the network
+       burst, INTLEVEL and SIMR, then the burst read verifying the configuration. */
+#ifdef W5500_FAST_BOOT
+    CHECK(8 == simulator.getStatistics().frameCount);
+#else
+    CHECK(9 == simulator.getStatistics().frameCount);
+#endif
+
+    /* A configuration lost on the bus fails the verification. */
+    simulator.setCommonWritesDropped(true);
+    W5500 faultyChip(TEST_CHIP_CONFIGURATION);
+#ifdef W5500_FAST_BOOT
+    CHECK(faultyChip.isConfigured());
+#else
+    CHECK(!faultyChip.isConfigured());
+#endif
+    simulator.setCommonWritesDropped(false);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,122 @@
+/**
+ *  \file   interrupt_coalescing_test.cpp
+ *  \brief  Adapts INTLEVEL to the number of socket events handled per interrupt pass.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+/* Returns the INTLEVEL register of the simulated chip. */
+uint16_t getInterruptLevelRegister(const W5500Simulator& simulator)
+{
+    return (static_cast<uint16_t>(simulator.getCommonRegister(0x0013)) << 8) + simulator.getCommonRegister(0x0014);
+}
+
+/* Raises RECV on each of the passed sockets and handles them in one pass. */
+void handleReceivedData(W5500Simulator& simulator, W5500& chip, TcpSocket* sockets, const uint8_t& socketCount)
+{
+    const unsigned char data[1] = {'x'};
+
+    for (uint8_t i = 0; i < socketCount; i++)
+    {
+        CHECK(1 == simulator.injectData(sockets[i].getIndex(), data, sizeof(data)));
+    }
+
+    chip.handleInterrupt();
+
+    for (uint8_t i = 0; i < socketCount; i++)
+    {
+        CHECK(1 == sockets[i].skip(1));
+    }
+}
+
+/* Echoes the received data, which reads Sn_IR again while the pass is running. */
+void echoReceivedData(AbstractSocket& socket, RxView& receivedData)
+{
+    receivedData.consume(0xffff);
+    CHECK(4 == socket.send("echo"));
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    /* INTLEVEL stays fixed at its maximum unless coalescing is configured. */
+    CHECK(0xffff == chip.getInterruptLevel());
+    CHECK(0xffff == getInterruptLevelRegister(simulator));
+
+    TcpSocket sockets[3];
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        connectTestSocket(chip, sockets[i], 1000 + i, 50000 + i);
+    }
+
+    CHECK(0xffff == chip.getInterruptLevel());
+
+    chip.setInterruptCoalescing(100, 1000, 3);
+    CHECK(100 == chip.getInterruptLevel());
+    CHECK(100 == getInterruptLevelRegister(simulator));
+
+    /* Bursts widen INTLEVEL up to the maximum. */
+    handleReceivedData(simulator, chip, sockets, 3);
+    CHECK(201 == chip.getInterruptLevel());
+    CHECK(201 == getInterruptLevelRegister(simulator));
+
+    handleReceivedData(simulator, chip, sockets, 3);
+    handleReceivedData(simulator, chip, sockets, 3);
+    CHECK(807 == chip.getInterruptLevel());
+
+    handleReceivedData(simulator, chip, sockets, 3);
+    CHECK(1000 == chip.getInterruptLevel());
+    CHECK(1000 == getInterruptLevelRegister(simulator));
+
+    /* Passes between quiet and burst keep the level. */
+    handleReceivedData(simulator, chip, sockets, 2);
+    CHECK(1000 == chip.getInterruptLevel());
+
+    /* Quiet passes narrow it down to the minimum again. */
+    handleReceivedData(simulator, chip, sockets, 1);
+    CHECK(500 == chip.getInterruptLevel());
+
+    chip.handleInterrupt();
+    CHECK(250 == chip.getInterruptLevel());
+
+    handleReceivedData(simulator, chip, sockets, 1);
+    handleReceivedData(simulator, chip, sockets, 1);
+    CHECK(100 == chip.getInterruptLevel());
+    CHECK(100 == getInterruptLevelRegister(simulator));
+
+    /* A maximum below the minimum fixes INTLEVEL. */
+    chip.setInterruptCoalescing(300, 200);
+    CHECK(300 == chip.getInterruptLevel());
+
+    handleReceivedData(simulator, chip, sockets, 3);
+    CHECK(300 == chip.getInterruptLevel());
+    handleReceivedData(simulator, chip, sockets, 1);
+    CHECK(300 == chip.getInterruptLevel());
+    CHECK(300 == getInterruptLevelRegister(simulator));
+
+    /* Callbacks touching the socket registers do not hide the events of the pass. */
+    chip.setInterruptCoalescing(100, 1000, 3);
+    const unsigned char data[1] = {'x'};
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        CHECK(sockets[i].addReceiveCallbackFunction(echoReceivedData));
+        CHECK(1 == simulator.injectData(sockets[i].getIndex(), data, sizeof(data)));
+    }
+
+    chip.handleInterrupt();
+    CHECK(201 == chip.getInterruptLevel());
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        CHECK(4 == simulator.takeTransmittedData(sockets[i].getIndex()).size());
+    }
+
+    return EXIT_SUCCESS;
+}
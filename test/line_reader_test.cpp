@@ -0,0 +1,67 @@
+/**
+ *  \file   line_reader_test.cpp
+ *  \brief  Receives delimited records and lines from a connected TCP socket.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+namespace
+{
+/* Injects the passed string as received data and handles the interrupt. */
+void injectString(W5500Simulator& simulator, W5500& chip, const uint8_t& socket, const char* data)
+{
+    CHECK(simulator.injectData(socket, reinterpret_cast<const unsigned char*>(data), strlen(data)) == strlen(data));
+    chip.handleInterrupt();
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    const char request[] = "GET / HTTP/1.0\r\n";
+    injectString(simulator, chip, index, request);
+
+    char line[32];
+    CHECK(socket.readLine(line, sizeof(line)) == strlen(request));
+    CHECK(0 == strcmp(line, "GET / HTTP/1.0"));
+    CHECK(0 == socket.available());
+
+    /* An incomplete line is left in the RX buffer until its terminator arrives. */
+    injectString(simulator, chip, index, "Host: exam");
+    CHECK(0 == socket.readLine(line, sizeof(line)));
+    CHECK(0 == strcmp(line, ""));
+    CHECK(10 == socket.available());
+
+    /* Only the first line is consumed, the following data stays buffered. */
+    injectString(simulator, chip, index, "ple.com\nAccept: */*\r\n");
+    CHECK(18 == socket.readLine(line, sizeof(line)));
+    CHECK(0 == strcmp(line, "Host: example.com"));
+    CHECK(13 == socket.available());
+    CHECK(13 == socket.readLine(line, sizeof(line)));
+    CHECK(0 == strcmp(line, "Accept: */*"));
+
+    /* Records longer than the destination come back truncated without delimiter,
+       spanning several read chunks. */
+    injectString(simulator, chip, index, "0123456789abcdefghijklmnopqrstuv;x;");
+
+    uint8_t record[24];
+    CHECK(sizeof(record) == socket.readUntil(record, sizeof(record), ';'));
+    CHECK(0 == memcmp(record, "0123456789abcdefghijklmn", sizeof(record)));
+    CHECK(9 == socket.readUntil(record, sizeof(record), ';'));
+    CHECK(0 == memcmp(record, "opqrstuv;", 9));
+    CHECK(2 == socket.readUntil(record, sizeof(record), ';'));
+    CHECK(0 == memcmp(record, "x;", 2));
+    CHECK(0 == socket.readUntil(record, sizeof(record), ';'));
+    CHECK(0 == socket.readLine(line, 0));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ *  \file   poll_readiness_test.cpp
+ *  \brief  Collects the readiness of sockets like select() instead of running callbacks.
+ */
+
+#include "test_socket.hpp"
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    listenTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+    const uint8_t socketBit = 1 << index;
+    uint8_t readiness[8];
+
+    /* An idle chip costs a single frame. */
+    simulator.resetStatistics();
+    CHECK(0x00 == chip.pollReadiness(readiness));
+    CHECK(1 == simulator.getStatistics().frameCount);
+    CHECK(0x00 == readiness[index]);
+
+    /* Connected is an edge, an established socket with free TX space stays writable. */
+    CHECK(simulator.establishConnection(index, testPeerAddress, 50000));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK((SocketReadiness::Connected | SocketReadiness::Writable) == readiness[index]);
+
+    simulator.resetStatistics();
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK(SocketReadiness::Writable == readiness[index]);
+    CHECK(1 == simulator.getStatistics().frameCount);
+
+    /* Data left after a partial read keeps the socket readable. */
+    const unsigned char request[2] = {'h', 'i'};
+    CHECK(simulator.injectData(index, request, sizeof(request)) == sizeof(request));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK((SocketReadiness::Readable | SocketReadiness::Writable) == readiness[index]);
+
+    uint8_t received[2];
+    CHECK(1 == socket.recv(received, 1));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK((SocketReadiness::Readable | SocketReadiness::Writable) == readiness[index]);
+    CHECK(1 == socket.available());
+
+    CHECK(1 == socket.recv(received, sizeof(received)));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK(SocketReadiness::Writable == readiness[index]);
+
+    /* A full TX buffer isn't writable until SEND_OK frees it. */
+    static unsigned char message[2048];
+    simulator.setSendCompletionDeferred(true);
+    CHECK(sizeof(message) == socket.trySend(message, sizeof(message)));
+    CHECK(0x00 == chip.pollReadiness(readiness));
+    CHECK(0x00 == readiness[index]);
+
+    CHECK(simulator.completeSend(index));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK(SocketReadiness::Writable == readiness[index]);
+    CHECK(sizeof(message) == simulator.takeTransmittedData(index).size());
+
+    /* Data received before the peer closed stays readable next to Closed. */
+    CHECK(simulator.injectData(index, request, sizeof(request)) == sizeof(request));
+    simulator.closeConnection(index);
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        CHECK(socketBit == chip.pollReadiness(readiness));
+        CHECK(readiness[index] & SocketReadiness::Readable);
+        CHECK(readiness[index] & SocketReadiness::Closed);
+    }
+
+    CHECK(sizeof(request) == socket.recv(received, sizeof(received)));
+    CHECK(socketBit == chip.pollReadiness(readiness));
+    CHECK(0 == (readiness[index] & SocketReadiness::Readable));
+
+    return EXIT_SUCCESS;
+}
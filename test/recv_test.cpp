@@ -0,0 +1,65 @@
+/**
+ *  \file   recv_test.cpp
+ *  \brief  Receives data into caller-owned buffers from a connected TCP socket.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    unsigned char received[700] = {};
+    CHECK(0 == socket.available());
+    CHECK(0 == socket.recv(received, sizeof(received)));
+
+    const unsigned char request[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    CHECK(simulator.injectData(index, request, sizeof(request)) == sizeof(request));
+    chip.handleInterrupt();
+    CHECK(sizeof(request) == socket.available());
+
+    /* peek() leaves the data, skip() drops it unread and recv() stops at the capacity. */
+    CHECK(4 == socket.peek(received, 4));
+    CHECK(0 == memcmp(received, request, 4));
+    CHECK(sizeof(request) == socket.available());
+
+    CHECK(2 == socket.skip(2));
+    CHECK(3 == socket.recv(received, 3));
+    CHECK(0 == memcmp(received, request + 2, 3));
+
+    simulator.resetStatistics();
+    CHECK(5 == socket.recv(received, sizeof(received)));
+    CHECK(0 == memcmp(received, request + 5, 5));
+    CHECK(1 == simulator.getStatistics().recvCommandCount);
+    CHECK(0 == socket.available());
+
+    /* 700 byte chunks never align with the 2 KB buffer, so reads are split
+       at the end of the buffer memory. */
+    static unsigned char chunk[700];
+
+    for (uint16_t i = 0; i < 20; i++)
+    {
+        for (uint16_t j = 0; j < sizeof(chunk); j++)
+        {
+            chunk[j] = static_cast<unsigned char>(i * 31 + j);
+        }
+
+        CHECK(simulator.injectData(index, chunk, sizeof(chunk)) == sizeof(chunk));
+        chip.handleInterrupt();
+
+        CHECK(socket.recv(received, sizeof(received)) == sizeof(received));
+        CHECK(0 == memcmp(received, chunk, sizeof(chunk)));
+    }
+
+    CHECK(0 == socket.available());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/**
+ *  \file   rx_view_test.cpp
+ *  \brief  Parses received data in place through an RxView.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    CHECK(socket.view().isEmpty());
+
+    /* The boundary lies beyond the first scan chunks, and a partial match
+       precedes it, so the pattern search has to resume across chunks. */
+    const char request[] = "POST /upload HTTP/1.0\r\nContent-Length: 4\r\n\r\r\n\r\nbody";
+    const uint16_t requestLength = strlen(request);
+    CHECK(simulator.injectData(index, reinterpret_cast<const unsigned char*>(request), requestLength)
+          == requestLength);
+    chip.handleInterrupt();
+
+    RxView receivedData = socket.view();
+    CHECK(requestLength == receivedData.size());
+    CHECK('P' == receivedData.at(0));
+    CHECK('y' == receivedData.at(requestLength - 1));
+
+    const uint16_t headerEnd = strstr(request, "\r\n\r\n") - request;
+    const uint8_t boundary[4] = {'\r', '\n', '\r', '\n'};
+    CHECK(headerEnd == receivedData.find(boundary, sizeof(boundary)));
+    CHECK(RxView::npos == receivedData.find(boundary, sizeof(boundary), headerEnd + 1));
+    CHECK(RxView::npos == receivedData.find(boundary, sizeof(boundary), requestLength));
+
+    CHECK(4 == receivedData.find(' '));
+    CHECK(12 == receivedData.find(' ', 5));
+    CHECK(RxView::npos == receivedData.find('#'));
+
+    const uint8_t missing[3] = {'b', 'o', 'x'};
+    CHECK(RxView::npos == receivedData.find(missing, sizeof(missing)));
+    CHECK(7 == receivedData.find(missing, 0, 7));
+
+    /* Reads are clamped to the view, nothing is consumed until consume(). */
+    uint8_t body[8] = {};
+    CHECK(4 == receivedData.read(requestLength - 4, body, sizeof(body)));
+    CHECK(0 == memcmp(body, "body", 4));
+    CHECK(0 == receivedData.read(requestLength, body, sizeof(body)));
+    CHECK(requestLength == socket.available());
+
+    simulator.resetStatistics();
+    CHECK(headerEnd + sizeof(boundary) == receivedData.consume(headerEnd + sizeof(boundary)));
+    CHECK(1 == simulator.getStatistics().recvCommandCount);
+    CHECK(4 == receivedData.size());
+    CHECK('b' == receivedData.at(0));
+    CHECK(4 == socket.available());
+
+    CHECK(4 == receivedData.consume(100));
+    CHECK(receivedData.isEmpty());
+    CHECK(0 == socket.available());
+
+    return EXIT_SUCCESS;
+}
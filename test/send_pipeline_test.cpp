@@ -0,0 +1,95 @@
+/**
+ *  \file   send_pipeline_test.cpp
+ *  \brief  Pipelines asynchronous sends while the previous SEND is still in flight.
+ */
+
+#include "test_socket.hpp"
+
+#include <avr/interrupt.h>
+#include <string.h>
+
+#ifndef W5500_SPI_ISR
+ISR(SPI_STC_vect)
+{
+    W5500::handleTransferInterrupt();
+}
+#endif
+
+namespace
+{
+/* Echoes the received data from within the interrupt pass. */
+void echoReceivedData(AbstractSocket& socket, RxView& receivedData)
+{
+    receivedData.consume(0xffff);
+    CHECK(4 == socket.send("echo"));
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+    CHECK(chip.isConfigured());
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+    CHECK(socket.isConnected());
+
+    simulator.setSendCompletionDeferred(true);
+
+    static unsigned char payload[1536];
+    memset(payload, 'A', sizeof(payload));
+    CHECK(socket.sendAsync(payload, sizeof(payload)) == sizeof(payload));
+    CHECK(0 == socket.sendAsync(payload, sizeof(payload)));
+    CHECK(simulator.completeSend(socket.getIndex()));
+
+    memset(payload, 'B', sizeof(payload));
+    CHECK(socket.sendAsync(payload, sizeof(payload)) == sizeof(payload));
+    CHECK(simulator.completeSend(socket.getIndex()));
+    CHECK(0 == simulator.getStatistics().overlappedSendCount);
+
+    std::vector<unsigned char> transmittedData = simulator.takeTransmittedData(socket.getIndex());
+    CHECK(transmittedData.size() == 2 * sizeof(payload));
+    CHECK('A' == transmittedData.front() && 'B' == transmittedData.back());
+
+    /* Data written while a SEND is in flight goes into the free TX space,
+       its SEND follows as soon as the interrupt reports SEND_OK. */
+    simulator.resetStatistics();
+    CHECK(socket.trySend(payload, 512) == 512);
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    memset(payload, 'C', sizeof(payload));
+    CHECK(socket.trySend(payload, 512) == 512);
+    CHECK(socket.trySend(payload, 512) == 512);
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    CHECK(simulator.completeSend(socket.getIndex()));
+    chip.handleInterrupt();
+    CHECK(2 == simulator.getStatistics().sendCommandCount);
+    CHECK(simulator.completeSend(socket.getIndex()));
+    chip.handleInterrupt();
+    CHECK(0 == simulator.getStatistics().overlappedSendCount);
+
+    transmittedData = simulator.takeTransmittedData(socket.getIndex());
+    CHECK(transmittedData.size() == 3 * 512);
+    CHECK('B' == transmittedData.front() && 'C' == transmittedData[512] && 'C' == transmittedData.back());
+
+    /* A SEND_OK reported together with RECV completes before a receive
+       callback sends again, which would otherwise wait for it forever. */
+    CHECK(socket.addReceiveCallbackFunction(echoReceivedData));
+    const unsigned char request[1] = {'x'};
+
+    CHECK(1 == simulator.injectData(socket.getIndex(), request, sizeof(request)));
+    chip.handleInterrupt();
+    CHECK(simulator.completeSend(socket.getIndex()));
+
+    CHECK(1 == simulator.injectData(socket.getIndex(), request, sizeof(request)));
+    chip.handleInterrupt();
+    CHECK(simulator.completeSend(socket.getIndex()));
+    chip.handleInterrupt();
+
+    transmittedData = simulator.takeTransmittedData(socket.getIndex());
+    CHECK(transmittedData.size() == 8);
+
+    return EXIT_SUCCESS;
+}
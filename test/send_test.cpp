@@ -0,0 +1,90 @@
+/**
+ *  \file   send_test.cpp
+ *  \brief  Sends data through a connected TCP socket under TX free size flow control.
+ */
+
+#include "test_socket.hpp"
+
+#include <avr/interrupt.h>
+#include <string.h>
+
+#ifdef W5500_SPI_ISR_FORWARDED
+ISR(SPI_STC_vect)
+{
+    W5500::handleTransferInterrupt();
+}
+#endif
+
+namespace
+{
+uint8_t issuedSendCount = 0;
+
+void onSendIssued(void)
+{
+    issuedSendCount++;
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    const char response[] = "HTTP/1.0 200 OK\r\n";
+    CHECK(socket.send(response) == strlen(response));
+    expectTransmitted(index, response);
+
+    /* A message larger than the 2 KB TX buffer is accepted in parts as the
+       chip frees space. */
+    static unsigned char message[3000];
+
+    for (uint16_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = static_cast<unsigned char>(i * 7);
+    }
+
+    simulator.setSendCompletionDeferred(true);
+    simulator.resetStatistics();
+
+    CHECK(2048 == socket.trySend(message, sizeof(message)));
+    CHECK(0 == socket.trySend(message + 2048, sizeof(message) - 2048));
+    CHECK(simulator.completeSend(index));
+    CHECK(sizeof(message) - 2048 == socket.trySend(message + 2048, sizeof(message) - 2048));
+    CHECK(simulator.completeSend(index));
+
+    CHECK(2 == simulator.getStatistics().sendCommandCount);
+    CHECK(0 == simulator.getStatistics().overlappedSendCount);
+    expectTransmitted(index, message, sizeof(message));
+
+    simulator.setSendCompletionDeferred(false);
+    CHECK(socket.send(message, sizeof(message)) == sizeof(message));
+    expectTransmitted(index, message, sizeof(message));
+
+    /* 700 byte chunks never align with the 2 KB buffer, so writes are split
+       at the end of the buffer memory. */
+    for (uint16_t i = 0; i < 20; i++)
+    {
+        CHECK(socket.send(message + i, 700) == 700);
+        expectTransmitted(index, message + i, 700);
+    }
+
+    /* Without an ISR driving the transfer queue sendAsync() writes blocking,
+       so it has completed when it returns and later accesses don't wait. */
+    CHECK(socket.sendAsync(message, 100, onSendIssued) == 100);
+    CHECK(1 == issuedSendCount);
+    CHECK(!chip.isTransferPending());
+    expectTransmitted(index, message, 100);
+    CHECK(0 == socket.available());
+
+    simulator.closeConnection(index);
+    chip.handleInterrupt();
+    socket.disconnect();
+    CHECK(0 == socket.send(message, sizeof(message)));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+/**
+ *  \file   shadow_register_test.cpp
+ *  \brief  Skips writes of shadowed socket registers until bind or a chip reset.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+/* Exposes the protected mode setter of the socket. */
+class ShadowedSocket : public TcpSocket
+{
+public:
+    using AbstractSocket::setMode;
+};
+
+/* Returns the simulated Sn_PORT of a socket. */
+uint16_t getLocalPort(const W5500Simulator& simulator, const uint8_t& socket)
+{
+    return (static_cast<uint16_t>(simulator.getSocketRegister(socket, 0x0004)) << 8)
+           + simulator.getSocketRegister(socket, 0x0005);
+}
+
+/* Checks the simulated Sn_MR, Sn_PORT and Sn_IMR of a socket. */
+void checkSocketRegisters(const W5500Simulator& simulator,
+                          const uint8_t& socket,
+                          const unsigned char& mode,
+                          const uint16_t& port,
+                          const unsigned char& interruptMask)
+{
+    CHECK(mode == simulator.getSocketRegister(socket, 0x0000));
+    CHECK(port == getLocalPort(simulator, socket));
+    CHECK(interruptMask == simulator.getSocketRegister(socket, 0x002c));
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    ShadowedSocket socket;
+    socket.bind(&chip, 1000);
+
+    const uint8_t index = socket.getIndex();
+    const unsigned char interruptMask = simulator.getSocketRegister(index, 0x002c);
+    checkSocketRegisters(simulator, index, 0x01, 1000, interruptMask);
+
+    /* Writing the values the chip already holds costs no frame. */
+    simulator.resetStatistics();
+    socket.setMode(0x01);
+    socket.setLocalPort(1000);
+    socket.setInterruptMask(interruptMask);
+    CHECK(0 == simulator.getStatistics().frameCount);
+
+    /* A changed value is written once and shadowed again. */
+    socket.setLocalPort(1001);
+    CHECK(1 == simulator.getStatistics().frameCount);
+    socket.setLocalPort(1001);
+    CHECK(1 == simulator.getStatistics().frameCount);
+    checkSocketRegisters(simulator, index, 0x01, 1001, interruptMask);
+
+    /* bind() invalidates the shadow, so the same values reach the chip again,
+       here in the registers of the next free socket. */
+    socket.bind(&chip, 1001);
+    const uint8_t reboundIndex = socket.getIndex();
+    CHECK(index != reboundIndex && W5500::invalidSocketIndex != reboundIndex);
+    checkSocketRegisters(simulator, reboundIndex, 0x01, 1001, interruptMask);
+
+    simulator.resetStatistics();
+    socket.setMode(0x01);
+    socket.setLocalPort(1001);
+    socket.setInterruptMask(interruptMask);
+    CHECK(0 == simulator.getStatistics().frameCount);
+
+    /* A chip reset restores the register defaults, binding to the reset chip
+       writes mode, port and interrupt mask although the shadow still matches. */
+    W5500 resetChip(TEST_CHIP_CONFIGURATION);
+    CHECK(0x00 == simulator.getSocketRegister(index, 0x0000));
+    CHECK(0 == getLocalPort(simulator, index));
+
+    socket.bind(&resetChip, 1001);
+    CHECK(index == socket.getIndex());
+    checkSocketRegisters(simulator, index, 0x01, 1001, interruptMask);
+
+    return EXIT_SUCCESS;
+}
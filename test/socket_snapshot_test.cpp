@@ -0,0 +1,68 @@
+/**
+ *  \file   socket_snapshot_test.cpp
+ *  \brief  Takes socket snapshots and compares them with the simulated registers.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+/* Sn_TX_FSR and Sn_RX_RSR are read once more after the burst to confirm their value. */
+#ifdef W5500_FIXED_LENGTH_DATA_MODE
+/* Fixed length data mode splits the 12 byte buffer state into three 4 byte frames. */
+constexpr uint32_t fullSnapshotFrames = 6;
+constexpr uint32_t rxStateFrames = 3;
+#else
+constexpr uint32_t fullSnapshotFrames = 4;
+constexpr uint32_t rxStateFrames = 2;
+#endif
+
+/* Returns a two byte socket register of the simulated chip. */
+uint16_t getSocketWord(const W5500Simulator& simulator, const uint8_t& socket, const uint16_t& address)
+{
+    return (static_cast<uint16_t>(simulator.getSocketRegister(socket, address)) << 8)
+           + simulator.getSocketRegister(socket, address + 1);
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const unsigned char request[5] = {'h', 'e', 'l', 'l', 'o'};
+    CHECK(simulator.injectData(socket.getIndex(), request, sizeof(request)) == sizeof(request));
+    CHECK(socket.send("abc") == 3);
+
+    simulator.resetStatistics();
+    SocketSnapshot snapshot = socket.takeSnapshot();
+    CHECK(fullSnapshotFrames == simulator.getStatistics().frameCount);
+
+    const uint8_t index = socket.getIndex();
+    CHECK(simulator.getSocketRegister(index, 0x0002) == snapshot.interruptFlags);
+    CHECK(SocketStatus::Established == snapshot.status);
+    CHECK(SocketStatus::Established == socket.getStatus());
+    CHECK(2048 - static_cast<uint16_t>(snapshot.txWritePointer - snapshot.txReadPointer) == snapshot.txFreeSize);
+    CHECK(getSocketWord(simulator, index, 0x0022) == snapshot.txReadPointer);
+    CHECK(getSocketWord(simulator, index, 0x0024) == snapshot.txWritePointer);
+    CHECK(sizeof(request) == snapshot.rxReceivedSize);
+    CHECK(getSocketWord(simulator, index, 0x0028) == snapshot.rxReadPointer);
+    CHECK(getSocketWord(simulator, index, 0x002a) == snapshot.rxWritePointer);
+    CHECK(snapshot.rxWritePointer - snapshot.rxReadPointer == sizeof(request));
+
+    simulator.resetStatistics();
+    snapshot = socket.takeSnapshot(SnapshotPart::RXState);
+    CHECK(rxStateFrames == simulator.getStatistics().frameCount);
+    CHECK(8 == simulator.getStatistics().dataByteCount);
+    CHECK(sizeof(request) == snapshot.rxReceivedSize);
+    CHECK(0 == snapshot.txFreeSize && 0 == snapshot.status);
+
+    simulator.resetStatistics();
+    CHECK(socket.available() == sizeof(request));
+    CHECK(rxStateFrames == simulator.getStatistics().frameCount);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/**
+ *  \file   socket_task_test.cpp
+ *  \brief  Runs a line echo session as a SocketTask resumed only by socket events.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+namespace
+{
+/* Echoes lines until the peer sends "quit" or the connection ends. */
+class EchoTask : public SocketTask
+{
+public:
+    using SocketTask::SocketTask;
+
+    uint8_t runCount = 0;
+    uint8_t echoedLineCount = 0;
+
+protected:
+    void run(void) override
+    {
+        runCount++;
+
+        W5500_TASK_BEGIN();
+        W5500_TASK_AWAIT(_socket.acceptAsync(_asyncState));
+
+        while (!isFailed())
+        {
+            W5500_TASK_AWAIT(_socket.readLineAsync(_asyncState, _line, sizeof(_line)));
+
+            if (isFailed())
+            {
+                break;
+            }
+
+            if (0 == strcmp(_line, "quit"))
+            {
+                W5500_TASK_EXIT();
+            }
+
+            W5500_TASK_AWAIT(_socket.writeAsync(_asyncState, reinterpret_cast<const uint8_t*>(_line), strlen(_line)));
+            echoedLineCount++;
+            W5500_TASK_YIELD();
+        }
+
+        W5500_TASK_END();
+    }
+
+private:
+    char _line[16];
+};
+
+/* Lets the peer send the passed text and processes the interrupt. */
+void injectString(W5500Simulator& simulator, W5500& chip, const uint8_t& socket, const char* data)
+{
+    CHECK(simulator.injectData(socket, reinterpret_cast<const unsigned char*>(data), strlen(data)) == strlen(data));
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    socket.bind(&chip, 1000);
+
+    EchoTask task(socket);
+    const uint8_t index = socket.getIndex();
+
+    /* The task parks on the accept and isn't run again until the peer connects. */
+    CHECK(task.service());
+    CHECK(1 == task.runCount);
+    CHECK(TcpState::Listening == socket.getState());
+    CHECK(task.service());
+    CHECK(1 == task.runCount);
+
+    CHECK(simulator.establishConnection(index, testPeerAddress, 50000));
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+    CHECK(task.service());
+    CHECK(2 == task.runCount);
+    CHECK(task.service());
+    CHECK(2 == task.runCount);
+
+    /* A partial line doesn't let the read progress, the rest of it does. */
+    injectString(simulator, chip, index, "hel");
+    CHECK(task.service());
+    CHECK(3 == task.runCount);
+    CHECK(0 == task.echoedLineCount);
+
+    injectString(simulator, chip, index, "lo\r\n");
+    CHECK(task.service());
+    CHECK(4 == task.runCount);
+    CHECK(1 == task.echoedLineCount);
+    expectTransmitted(index, "hello");
+
+    /* After yielding the task runs on the next service() without an event. */
+    CHECK(task.service());
+    CHECK(5 == task.runCount);
+    CHECK(task.service());
+    CHECK(5 == task.runCount);
+
+    injectString(simulator, chip, index, "quit\n");
+    CHECK(!task.service());
+    CHECK(task.isFinished());
+    CHECK(!task.service());
+    CHECK(6 == task.runCount);
+
+    /* A closed connection fails the awaited read and ends the restarted task. */
+    socket.disconnect();
+    task.restart();
+    CHECK(task.service());
+
+    CHECK(simulator.establishConnection(index, testPeerAddress, 50001));
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+    CHECK(task.service());
+    CHECK(!task.isFinished());
+
+    simulator.closeConnection(index);
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+    CHECK(!task.service());
+    CHECK(task.isFinished());
+    CHECK(1 == task.echoedLineCount);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/**
+ *  \file   tcp_state_test.cpp
+ *  \brief  Walks a TCP socket through its connection states on the simulated W5500.
+ */
+
+#include "test_socket.hpp"
+
+namespace
+{
+TcpState reportedStates[32];
+uint8_t reportedStateCount = 0;
+uint8_t timeoutCount = 0;
+
+void onStateChanged(TcpSocket&, const TcpState& state)
+{
+    if (reportedStateCount < sizeof(reportedStates) / sizeof(reportedStates[0]))
+    {
+        reportedStates[reportedStateCount++] = state;
+    }
+}
+
+void onTimedOut(void)
+{
+    timeoutCount++;
+}
+} // namespace
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    socket.bind(&chip, 1000);
+    CHECK(socket.addStateCallbackFunction(onStateChanged));
+    CHECK(socket.addCallbackFunction(SocketEvent::TimedOut, onTimedOut));
+
+    socket.open();
+    CHECK(TcpState::Opened == socket.getState());
+    socket.listen();
+    CHECK(TcpState::Listening == socket.getState());
+
+    CHECK(simulator.establishConnection(socket.getIndex(), testPeerAddress, 50000));
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+    CHECK(TcpState::Established == socket.getState());
+
+    simulator.closeConnection(socket.getIndex());
+    chip.handleInterrupt();
+    CHECK(TcpState::PeerClosed == socket.getState());
+
+    socket.disconnect();
+    CHECK(TcpState::Closed == socket.getState());
+
+    const TcpState expectedStates[] = {TcpState::Opened,
+                                       TcpState::Listening,
+                                       TcpState::Established,
+                                       TcpState::PeerClosed,
+                                       TcpState::Closed};
+    CHECK(sizeof(expectedStates) / sizeof(expectedStates[0]) == reportedStateCount);
+
+    for (uint8_t i = 0; i < reportedStateCount; i++)
+    {
+        CHECK(expectedStates[i] == reportedStates[i]);
+    }
+
+    socket.open();
+    socket.setConnectionTimeout(3);
+    socket.connect(HostAddress("192.168.178.2"), 80);
+    CHECK(TcpState::Connecting == socket.getState());
+
+    chip.notifyTick();
+    chip.notifyTick();
+    chip.poll();
+    CHECK(0 == timeoutCount);
+
+    chip.notifyTick();
+    chip.poll();
+    CHECK(1 == timeoutCount);
+    CHECK(TcpState::Closed == socket.getState());
+
+    /* A connection established without its interrupt being handled outlives the deadline. */
+    socket.open();
+    socket.connect(HostAddress("192.168.178.2"), 80);
+    CHECK(simulator.establishConnection(socket.getIndex(), testPeerAddress, 80));
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        chip.notifyTick();
+    }
+
+    chip.poll();
+    CHECK(1 == timeoutCount);
+    CHECK(TcpState::Established == socket.getState());
+
+    chip.handleInterrupt();
+    socket.close();
+    CHECK(TcpState::Closed == socket.getState());
+
+    socket.open();
+    socket.listen();
+    CHECK(simulator.establishConnection(socket.getIndex(), testPeerAddress, 50001));
+    simulator.timeOutConnection(socket.getIndex());
+    chip.handleInterrupt();
+    CHECK(2 == timeoutCount);
+    CHECK(TcpState::Closed == socket.getState());
+
+    /* A close noticed by a send is reported like one noticed by an interrupt. */
+    socket.open();
+    socket.listen();
+    CHECK(simulator.establishConnection(socket.getIndex(), testPeerAddress, 50002));
+    chip.handleInterrupt();
+    CHECK(TcpState::Established == socket.getState());
+
+    const unsigned char partialLine[7] = {'p', 'a', 'r', 't', 'i', 'a', 'l'};
+    CHECK(simulator.injectData(socket.getIndex(), partialLine, sizeof(partialLine)) == sizeof(partialLine));
+    simulator.closeConnection(socket.getIndex());
+    simulator.setSendCompletionDeferred(true);
+
+    static uint8_t message[3000];
+    AsyncState writeState;
+    CHECK(AsyncResult::Pending == socket.writeAsync(writeState, message, sizeof(message)));
+    CHECK(2048 == writeState.progress);
+    CHECK(TcpState::PeerClosed == socket.getState());
+    CHECK(TcpState::PeerClosed == reportedStates[reportedStateCount - 1]);
+
+    /* Buffered data may still complete a line, a drained socket can't. */
+    char line[16];
+    AsyncState readState;
+    CHECK(AsyncResult::Pending == socket.readLineAsync(readState, line, sizeof(line)));
+    CHECK(sizeof(partialLine) == socket.skip(sizeof(partialLine)));
+    CHECK(AsyncResult::Failed == socket.readLineAsync(readState, line, sizeof(line)));
+
+    CHECK(simulator.completeSend(socket.getIndex()));
+    chip.handleInterrupt();
+    CHECK(AsyncResult::Done == socket.writeAsync(writeState, message, sizeof(message)));
+    CHECK(simulator.completeSend(socket.getIndex()));
+    CHECK(sizeof(message) == simulator.takeTransmittedData(socket.getIndex()).size());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,25 @@
+/**
+ *  \file   test_check.hpp
+ *  \brief  The file contains the check macro of the simulator tests.
+ *
+ *  Unlike assert() the check stays active in release builds and reports the
+ *  failing expression before the test exits with a failure code.
+ */
+
+#ifndef __TEST_CHECK_HPP__
+#define __TEST_CHECK_HPP__
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(condition)                                                            \
+    do                                                                              \
+    {                                                                               \
+        if (!(condition))                                                           \
+        {                                                                           \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(EXIT_FAILURE);                                                     \
+        }                                                                           \
+    } while (0)
+
+#endif //__TEST_CHECK_HPP__
@@ -0,0 +1,69 @@
+/**
+ *  \file   test_socket.hpp
+ *  \brief  The file contains the socket setup shared by the simulator tests.
+ *
+ *  The tests run against the simulated chip, whose peer is scripted through
+ *  the W5500Simulator instance.
+ */
+
+#ifndef __TEST_SOCKET_HPP__
+#define __TEST_SOCKET_HPP__
+
+#include "test_check.hpp"
+#include "w5500.hpp"
+
+#include <string.h>
+#include <w5500_simulator.hpp>
+
+/* Network configuration passed to the W5500 constructor of every test. */
+#define TEST_CHIP_CONFIGURATION "00-08-dc-ff-ff-ff", "192.168.178.1", "255.255.255.0", "192.168.178.101"
+
+/* IP address of the simulated peer. */
+static const unsigned char testPeerAddress[4] = {192, 168, 178, 2};
+
+/* Binds the socket to the chip, opens it and listens for a connection. */
+inline void listenTestSocket(W5500& chip,
+                             TcpSocket& socket,
+                             const uint16_t& port = 1000,
+                             const uint8_t& txBufferSize = 2,
+                             const uint8_t& rxBufferSize = 2)
+{
+    socket.bind(&chip, port, txBufferSize, rxBufferSize);
+    socket.open();
+    socket.listen();
+}
+
+/* Lets the simulated peer connect to the listening socket and handles the interrupt. */
+inline void connectTestPeer(W5500& chip, TcpSocket& socket, const uint16_t& peerPort = 50000)
+{
+    CHECK(W5500Simulator::getInstance().establishConnection(socket.getIndex(), testPeerAddress, peerPort));
+    chip.handleInterrupt();
+}
+
+/* Sets the socket up to listen and lets the simulated peer connect to it. */
+inline void connectTestSocket(W5500& chip,
+                              TcpSocket& socket,
+                              const uint16_t& port = 1000,
+                              const uint16_t& peerPort = 50000,
+                              const uint8_t& txBufferSize = 2,
+                              const uint8_t& rxBufferSize = 2)
+{
+    listenTestSocket(chip, socket, port, txBufferSize, rxBufferSize);
+    connectTestPeer(chip, socket, peerPort);
+}
+
+/* Checks that the peer received exactly the passed data since the last call. */
+inline void expectTransmitted(const uint8_t& socket, const void* data, const uint16_t& length)
+{
+    const std::vector<unsigned char> transmittedData = W5500Simulator::getInstance().takeTransmittedData(socket);
+    CHECK(transmittedData.size() == length);
+    CHECK(0 == memcmp(transmittedData.data(), data, length));
+}
+
+/* Checks that the peer received exactly the passed text since the last call. */
+inline void expectTransmitted(const uint8_t& socket, const char* text)
+{
+    expectTransmitted(socket, text, strlen(text));
+}
+
+#endif //__TEST_SOCKET_HPP__
@@ -0,0 +1,96 @@
+/**
+ *  \file   trace_test.cpp
+ *  \brief  Records driver events into the trace ring and drains them.
+ *
+ *  The drained records of a connection are written to the file passed as
+ *  argument, which the trace_decode_test runs W5500_TraceDecoder on.
+ */
+
+#include "test_socket.hpp"
+
+#include <avr/io.h>
+#include <stdio.h>
+
+namespace
+{
+/* Returns the first drained record of the passed event, or nullptr. */
+const TraceRecord* findRecord(const TraceRecord* records, const uint8_t& recordCount, const TraceEvent& event)
+{
+    for (uint8_t i = 0; i < recordCount; i++)
+    {
+        if (static_cast<uint8_t>(event) == records[i].event)
+        {
+            return records + i;
+        }
+    }
+
+    return nullptr;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    static_assert(6 == sizeof(TraceRecord), "Trace records are dumped as six bytes.");
+
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    listenTestSocket(chip, socket);
+
+    /* Draining the records of the setup restarts the overwritten count. */
+    static TraceRecord records[W5500_TRACE_CAPACITY];
+    CHECK(0 < Trace::drain(records, W5500_TRACE_CAPACITY));
+    CHECK(0 == Trace::getOverwrittenCount());
+    CHECK(0 == Trace::drain(records, W5500_TRACE_CAPACITY));
+
+    TCNT1 = 1000;
+    CHECK(simulator.establishConnection(socket.getIndex(), testPeerAddress, 50000));
+    chip.notifyInterrupt();
+    CHECK(chip.poll());
+
+    TCNT1 = 1100;
+    CHECK(5 == socket.send("hello"));
+
+    const uint8_t recordCount = Trace::drain(records, W5500_TRACE_CAPACITY);
+    CHECK(0 == Trace::getOverwrittenCount());
+    CHECK(static_cast<uint8_t>(TraceEvent::InterruptNotify) == records[0].event);
+    CHECK(1000 == records[0].timestamp);
+
+    const TraceRecord* interruptPass = findRecord(records, recordCount, TraceEvent::InterruptPass);
+    CHECK(interruptPass && (1 << socket.getIndex()) == interruptPass->argument);
+
+    const TraceRecord* stateChange = findRecord(records, recordCount, TraceEvent::StateChange);
+    CHECK(stateChange && socket.getIndex() == stateChange->socket);
+    CHECK(((static_cast<uint16_t>(TcpState::Established) << 8) | SocketStatus::Established) == stateChange->argument);
+
+    const TraceRecord* send = findRecord(records, recordCount, TraceEvent::Send);
+    CHECK(send && 1100 == send->timestamp && socket.getIndex() == send->socket && 5 == send->argument);
+
+    const TraceRecord* frameStart = findRecord(records, recordCount, TraceEvent::FrameStart);
+    const TraceRecord* frameEnd = findRecord(records, recordCount, TraceEvent::FrameEnd);
+    CHECK(frameStart && frameEnd && frameStart < frameEnd && frameStart->socket == frameEnd->socket);
+
+    if (argc > 1)
+    {
+        FILE* dump = fopen(argv[1], "wb");
+        CHECK(dump);
+        CHECK(recordCount == fwrite(records, sizeof(TraceRecord), recordCount, dump));
+        fclose(dump);
+    }
+
+    /* A full ring keeps the latest records and counts the lost ones. */
+    for (uint16_t i = 0; i < W5500_TRACE_CAPACITY + 6; i++)
+    {
+        Trace::record(TraceEvent::Receive, 1, i);
+    }
+
+    CHECK(6 == Trace::getOverwrittenCount());
+    CHECK(2 == Trace::drain(records, 2));
+    CHECK(6 == records[0].argument && 7 == records[1].argument);
+    CHECK(0 == Trace::getOverwrittenCount());
+    CHECK(W5500_TRACE_CAPACITY - 2 == Trace::drain(records, W5500_TRACE_CAPACITY));
+    CHECK(W5500_TRACE_CAPACITY + 5 == records[W5500_TRACE_CAPACITY - 3].argument);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/**
+ *  \file   tx_writer_test.cpp
+ *  \brief  Formats values into the TX buffer and sends them with a single SEND.
+ */
+
+#include "test_socket.hpp"
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    TcpSocket socket;
+    connectTestSocket(chip, socket);
+
+    const uint8_t index = socket.getIndex();
+
+    /* The report spans several windows but leaves as one SEND. */
+    simulator.resetStatistics();
+    {
+        TxWriter writer(socket);
+        writer << "temp=" << TxWriter::fixed(2315, 2) << " ip=" << HostAddress("192.168.178.101")
+               << " mac=" << MacAddress("00-08-dc-ff-ff-ff") << ' ' << TxWriter::hex(0xbeef, 8) << "\r\n";
+        CHECK(0 == simulator.getStatistics().sendCommandCount);
+    }
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+    expectTransmitted(index, "temp=23.15 ip=192.168.178.101 mac=00-08-dc-ff-ff-ff 0000beef\r\n");
+
+    TxWriter writer(socket);
+    writer << 0 << ' ' << -42 << ' ' << static_cast<unsigned char>(255) << ' ' << 65535u << ' ' << INT_MIN;
+    CHECK(writer.flush());
+    expectTransmitted(index, "0 -42 255 65535 -2147483648");
+
+    /* long is rendered in full wherever it is wider than 32 bits. */
+    writer << LONG_MIN << ' ' << ULONG_MAX << ' ' << LLONG_MIN << ' ' << ULLONG_MAX << ' ' << 5000000000LL;
+    CHECK(writer.flush());
+
+    char expected[96];
+    snprintf(expected, sizeof(expected), "%ld %lu %lld %llu 5000000000", LONG_MIN, ULONG_MAX, LLONG_MIN, ULLONG_MAX);
+    expectTransmitted(index, expected);
+
+    /* Fraction digit counts beyond 9 are rendered as 9, however the value was built. */
+    writer << TxWriter::fixed(-5, 2) << ' ' << TxWriter::fixed(7, 0) << ' ' << TxWriter::fixed(1234567890, 12)
+           << ' ' << TxWriter::Fixed{-1234567890, 200};
+    CHECK(writer.flush());
+    expectTransmitted(index, "-0.05 7 1.234567890 -1.234567890");
+
+    /* Raw data larger than the window bypasses it. */
+    static uint8_t block[100];
+    memset(block, 'x', sizeof(block));
+    simulator.resetStatistics();
+    writer << "<";
+    writer.write(block, sizeof(block));
+    writer << ">";
+    CHECK(writer.flush());
+    CHECK(1 == simulator.getStatistics().sendCommandCount);
+
+    const std::vector<unsigned char> transmittedData = simulator.takeTransmittedData(index);
+    CHECK(sizeof(block) + 2 == transmittedData.size());
+    CHECK('<' == transmittedData.front() && 'x' == transmittedData[1] && '>' == transmittedData.back());
+
+    return EXIT_SUCCESS;
+}
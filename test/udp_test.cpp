@@ -0,0 +1,60 @@
+/**
+ *  \file   udp_test.cpp
+ *  \brief  Binds a UDP socket, receives an injected datagram and sends one back.
+ */
+
+#include "test_socket.hpp"
+
+#include <string.h>
+
+int main(void)
+{
+    W5500Simulator& simulator = W5500Simulator::getInstance();
+    W5500 chip(TEST_CHIP_CONFIGURATION);
+
+    UdpSocket socket;
+    socket.bind(&chip, 2000);
+    CHECK(W5500::invalidSocketIndex != socket.getIndex());
+    CHECK(!socket.isOpen());
+
+    socket.open();
+    CHECK(socket.isOpen());
+
+    const uint8_t index = socket.getIndex();
+    CHECK(0x02 == simulator.getSocketRegister(index, 0x0000));
+    CHECK(0x07 == simulator.getSocketRegister(index, 0x0004));
+    CHECK(0xd0 == simulator.getSocketRegister(index, 0x0005));
+
+    /* The chip prepends the peer address, port and length to every datagram. */
+    const unsigned char request[5] = {'p', 'i', 'n', 'g', '!'};
+    CHECK(simulator.injectDatagram(index, testPeerAddress, 50000, request, sizeof(request)));
+    chip.handleInterrupt();
+    CHECK(8 + sizeof(request) == socket.available());
+
+    unsigned char header[8] = {};
+    CHECK(sizeof(header) == socket.recv(header, sizeof(header)));
+    CHECK(0 == memcmp(header, testPeerAddress, 4));
+    CHECK(50000 == ((header[4] << 8) | header[5]));
+    CHECK(sizeof(request) == ((header[6] << 8) | header[7]));
+
+    unsigned char received[16] = {};
+    CHECK(sizeof(request) == socket.recv(received, sizeof(received)));
+    CHECK(0 == memcmp(received, request, sizeof(request)));
+    CHECK(0 == socket.available());
+
+    CHECK(4 == socket.send("pong"));
+    chip.handleInterrupt();
+    expectTransmitted(index, "pong");
+
+    /* Without a free socket the UDP socket stays unbound like a TCP socket. */
+    UdpSocket sockets[8];
+
+    for (UdpSocket& other : sockets)
+    {
+        other.bind(&chip, 3000);
+    }
+
+    CHECK(W5500::invalidSocketIndex == sockets[7].getIndex());
+
+    return EXIT_SUCCESS;
+}